@@ -0,0 +1,61 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "BenchUtil.h"
+
+// Replacement global allocation functions that count every heap call made by a benchmark binary.
+
+static std::atomic<std::uint64_t> allocationCount(0);
+static std::atomic<std::uint64_t> freeCount(0);
+static std::atomic<std::uint64_t> allocatedBytes(0);
+
+AllocationCounters allocationCounters()
+{
+    AllocationCounters counters;
+    counters.allocations = allocationCount.load(std::memory_order_relaxed);
+    counters.frees = freeCount.load(std::memory_order_relaxed);
+    counters.bytes = allocatedBytes.load(std::memory_order_relaxed);
+    return counters;
+}
+
+void *operator new(std::size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    void *memory = std::malloc(size == 0 ? 1 : size);
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void *operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void *memory) noexcept
+{
+    if (memory != nullptr)
+    {
+        freeCount.fetch_add(1, std::memory_order_relaxed);
+        std::free(memory);
+    }
+}
+
+void operator delete[](void *memory) noexcept
+{
+    ::operator delete(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+    ::operator delete(memory);
+}
+
+void operator delete[](void *memory, std::size_t) noexcept
+{
+    ::operator delete(memory);
+}
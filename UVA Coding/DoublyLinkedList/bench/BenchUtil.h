@@ -0,0 +1,185 @@
+#ifndef BENCHUTIL_H
+#define BENCHUTIL_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+/**
+ * @brief Heap activity seen by the replacement operator new/delete in AllocCounter.cpp.
+ */
+struct AllocationCounters
+{
+    std::uint64_t allocations; /**< Calls to operator new. */
+    std::uint64_t frees;       /**< Calls to operator delete with a non-null pointer. */
+    std::uint64_t bytes;       /**< Bytes requested from operator new. */
+};
+
+/**
+ * @brief Returns the heap counters accumulated since the program started.
+ *
+ * @return A snapshot of the counters.
+ */
+AllocationCounters allocationCounters();
+
+/**
+ * @brief Result of one timed benchmark run.
+ */
+struct Measurement
+{
+    double nsPerOp;     /**< Wall-clock nanoseconds per operation. */
+    double allocsPerOp;  /**< Calls to operator new per operation. */
+};
+
+/**
+ * @brief Times `body` and divides its wall-clock time and heap calls by `operations`.
+ *
+ * @param operations The number of operations `body` performs.
+ * @param body The code to measure.
+ * @return The per-operation cost.
+ */
+template <typename Body>
+Measurement measure(std::size_t operations, Body body)
+{
+    AllocationCounters before = allocationCounters();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    body();
+    std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+    AllocationCounters after = allocationCounters();
+
+    double ops = operations == 0 ? 1.0 : static_cast<double>(operations);
+    Measurement result;
+    result.nsPerOp = std::chrono::duration<double, std::nano>(stop - start).count() / ops;
+    result.allocsPerOp = static_cast<double>(after.allocations - before.allocations) / ops;
+    return result;
+}
+
+/**
+ * @brief Returns the peak resident set size of the process so far.
+ *
+ * @return Peak RSS in kilobytes.
+ */
+inline long peakRssKilobytes()
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+/**
+ * @brief Returns the number of heap bytes in use, including the allocator's per-chunk headers.
+ *
+ * Where glibc's mallinfo2 is unavailable this falls back to the bytes requested through operator new so far,
+ * which leaves out the headers and never goes down, so only differences over an allocation-only span are meaningful.
+ * @return The heap bytes in use.
+ */
+inline std::uint64_t heapBytesInUse()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+#else
+    return allocationCounters().bytes;
+#endif
+}
+
+/**
+ * @brief Builds the benchmark sizes 10^lowExponent .. maxSize, one per power of ten.
+ *
+ * @param lowExponent The exponent of the smallest size.
+ * @param maxSize The largest size, normally taken from the command line.
+ * @return The sizes in increasing order.
+ */
+inline std::vector<std::size_t> powersOfTen(int lowExponent, std::size_t maxSize)
+{
+    std::vector<std::size_t> sizes;
+    std::size_t size = 1;
+    for (int i = 0; i < lowExponent; i++)
+    {
+        size *= 10;
+    }
+    for (; size <= maxSize; size *= 10)
+    {
+        sizes.push_back(size);
+    }
+    return sizes;
+}
+
+/**
+ * @brief Reads the largest benchmark size from argv[1], falling back to `fallback`.
+ *
+ * @param argc Argument count from main.
+ * @param argv Argument vector from main.
+ * @param fallback The size to use when no argument is given.
+ * @return The largest size to run.
+ */
+inline std::size_t maxSizeArgument(int argc, char **argv, std::size_t fallback)
+{
+    if (argc > 1)
+    {
+        return static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10));
+    }
+    return fallback;
+}
+
+/**
+ * @class ZipfGenerator
+ * @brief Draws keys in [0, keyCount) with P(k) proportional to 1 / (k + 1)^exponent.
+ *
+ * Key 0 is the most popular. Sampling is a binary search over a precomputed CDF.
+ */
+class ZipfGenerator
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param keyCount The number of distinct keys.
+     * @param exponent The skew; 0 is uniform, around 1 is typical of real access logs.
+     * @param seed The seed of the random engine, so runs are reproducible.
+     */
+    ZipfGenerator(std::size_t keyCount, double exponent, std::uint64_t seed = 1)
+        : cdf(keyCount), engine(seed), uniform(0.0, 1.0)
+    {
+        double total = 0.0;
+        for (std::size_t k = 0; k < keyCount; k++)
+        {
+            total += 1.0 / std::pow(static_cast<double>(k + 1), exponent);
+            cdf[k] = total;
+        }
+        for (double &value : cdf)
+        {
+            value /= total;
+        }
+    }
+
+    /**
+     * @brief Draws the next key.
+     *
+     * @return A key in [0, keyCount).
+     */
+    std::size_t next()
+    {
+        std::vector<double>::const_iterator position = std::lower_bound(cdf.begin(), cdf.end(), uniform(engine));
+        return position == cdf.end() ? cdf.size() - 1 : static_cast<std::size_t>(position - cdf.begin());
+    }
+
+private:
+    std::vector<double> cdf;
+    std::mt19937_64 engine;
+    std::uniform_real_distribution<double> uniform;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,193 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../src/ConcurrentDeque.h"
+#include "../src/List.h"
+#include "BenchUtil.h"
+
+// Multi-threaded throughput of ConcurrentDeque against a List<T> guarded by one mutex.
+// Usage: ConcurrentDequeBench [maxThreads]   (threads run 1, 2, 4, ... up to maxThreads; default 64)
+
+/**
+ * @brief The baseline: List<long long> with every operation under a single mutex.
+ */
+class LockedList
+{
+public:
+    void pushFront(long long x)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        list.insertAtFront(x);
+    }
+
+    void pushBack(long long x)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        list.insertAtTail(x);
+    }
+
+    bool popFront(long long &out)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (list.isEmpty())
+        {
+            return false;
+        }
+        out = list.first().retrieve();
+        list.erase(list.first());
+        return true;
+    }
+
+    bool popBack(long long &out)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (list.isEmpty())
+        {
+            return false;
+        }
+        out = list.last().retrieve();
+        list.erase(list.last());
+        return true;
+    }
+
+private:
+    std::mutex lock;
+    List<long long> list;
+};
+
+/**
+ * @brief A contention mix: what each thread does on each step.
+ */
+enum class Mix
+{
+    Queue,     // Even threads pushBack, odd threads popFront (producer/consumer handoff)
+    Symmetric, // Every thread alternates push and pop at both ends
+    Stack      // Every thread pushes and pops at the back only, so all traffic hits one end
+};
+
+static const char *mixName(Mix mix)
+{
+    switch (mix)
+    {
+    case Mix::Queue:
+        return "queue";
+    case Mix::Symmetric:
+        return "symmetric";
+    default:
+        return "stack";
+    }
+}
+
+template <typename Deque>
+static void step(Deque &deque, Mix mix, int thread, std::size_t i)
+{
+    long long out;
+    switch (mix)
+    {
+    case Mix::Queue:
+        if (thread % 2 == 0)
+        {
+            deque.pushBack(static_cast<long long>(i));
+        }
+        else
+        {
+            deque.popFront(out);
+        }
+        break;
+    case Mix::Symmetric:
+        switch (i % 4)
+        {
+        case 0:
+            deque.pushBack(static_cast<long long>(i));
+            break;
+        case 1:
+            deque.pushFront(static_cast<long long>(i));
+            break;
+        case 2:
+            deque.popFront(out);
+            break;
+        default:
+            deque.popBack(out);
+            break;
+        }
+        break;
+    case Mix::Stack:
+        if (i % 2 == 0)
+        {
+            deque.pushBack(static_cast<long long>(i));
+        }
+        else
+        {
+            deque.popBack(out);
+        }
+        break;
+    }
+}
+
+template <typename Deque>
+static double run(Mix mix, int threads, std::size_t totalOps)
+{
+    Deque deque;
+    for (int i = 0; i < 1024; i++)
+    {
+        deque.pushBack(i);
+    }
+
+    std::size_t perThread = totalOps / static_cast<std::size_t>(threads);
+    std::atomic<int> ready(0);
+    std::atomic<bool> go(false);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++)
+    {
+        workers.emplace_back([&, t]() {
+            ready++;
+            while (!go.load())
+            {
+                std::this_thread::yield();
+            }
+            for (std::size_t i = 0; i < perThread; i++)
+            {
+                step(deque, mix, t, i);
+            }
+        });
+    }
+    while (ready.load() != threads)
+    {
+        std::this_thread::yield();
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    go.store(true);
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+    std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(stop - start).count();
+    return static_cast<double>(perThread * threads) / seconds / 1e6;
+}
+
+int main(int argc, char **argv)
+{
+    int maxThreads = static_cast<int>(maxSizeArgument(argc, argv, 64));
+    const std::size_t totalOps = 2000000;
+    const Mix mixes[] = {Mix::Queue, Mix::Symmetric, Mix::Stack};
+
+    std::printf("hardware threads: %u\n", std::thread::hardware_concurrency());
+    for (Mix mix : mixes)
+    {
+        for (int threads = 1; threads <= maxThreads; threads *= 2)
+        {
+            double lockFree = run<ConcurrentDeque<long long>>(mix, threads, totalOps);
+            double locked = run<LockedList>(mix, threads, totalOps);
+            std::printf("%-10s threads=%-3d ConcurrentDeque %8.2f Mops/s   mutex+List %8.2f Mops/s\n",
+                        mixName(mix), threads, lockFree, locked);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,58 @@
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "../src/List.h"
+#include "BenchUtil.h"
+
+// Compares the per-element `os << value << " "` loop with List::print and exportRange to a file descriptor.
+// Usage: ExportBench [maxSize]   (output goes to /dev/null)
+
+static void report(const char *method, const char *type, std::size_t size, const Measurement &m)
+{
+    std::printf("%-22s %-7s %10zu %10.2f ns/elem %8.3f allocs/elem\n", method, type, size, m.nsPerOp, m.allocsPerOp);
+}
+
+template <typename T, typename Make>
+static void run(const char *type, std::size_t size, Make make)
+{
+    List<T> list;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        list.insertAtTail(make(i));
+    }
+
+    std::ofstream sink("/dev/null");
+    Measurement perElement = measure(size, [&]() {
+        for (const T &value : list)
+        {
+            sink << value << " ";
+        }
+        sink << std::endl;
+    });
+    report("operator<< loop", type, size, perElement);
+
+    Measurement printed = measure(size, [&]() { list.print(sink, true); });
+    report("print", type, size, printed);
+
+    int fd = ::open("/dev/null", O_WRONLY);
+    Measurement exported = measure(size, [&]() { list.exportRange(fd, list.cbegin(), list.cend()); });
+    report("exportRange(fd)", type, size, exported);
+    ::close(fd);
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t maxSize = maxSizeArgument(argc, argv, 1000000);
+    std::mt19937_64 rng(1);
+    for (std::size_t size : powersOfTen(4, maxSize))
+    {
+        run<int>("int", size, [&rng](std::size_t) { return static_cast<int>(rng()); });
+        run<double>("double", size, [&rng](std::size_t) { return static_cast<double>(rng() % 1000000) / 7.0; });
+    }
+    return 0;
+}
@@ -0,0 +1,198 @@
+#include <cstdio>
+#include <cstring>
+#include <ostream>
+#include <random>
+#include <streambuf>
+#include <string>
+
+#include "../src/List.h"
+#include "BenchUtil.h"
+
+// Reproducible microbenchmarks of every List<T> operation for int, a 64-byte POD and std::string.
+// Prints one JSON document to stdout so that runs can be diffed.
+// Usage: ListBench [maxSize]   (sizes run 10, 100, ... up to maxSize; default 10^6, 10^8 supported)
+
+/**
+ * @brief A 64-byte trivially copyable payload.
+ */
+struct Pod64
+{
+    long long fields[8];
+
+    bool operator!=(const Pod64 &other) const
+    {
+        return std::memcmp(fields, other.fields, sizeof(fields)) != 0;
+    }
+};
+
+std::ostream &operator<<(std::ostream &os, const Pod64 &pod)
+{
+    return os << pod.fields[0];
+}
+
+template <typename T>
+T makeValue(std::size_t i);
+
+template <>
+int makeValue<int>(std::size_t i)
+{
+    return static_cast<int>(i);
+}
+
+template <>
+Pod64 makeValue<Pod64>(std::size_t i)
+{
+    Pod64 pod;
+    for (long long &field : pod.fields)
+    {
+        field = static_cast<long long>(i);
+    }
+    return pod;
+}
+
+template <>
+std::string makeValue<std::string>(std::size_t i)
+{
+    // Longer than the small-string buffer, so every string owns a heap block
+    std::string text = "list-bench-value-" + std::to_string(i);
+    text.resize(32, '.');
+    return text;
+}
+
+/**
+ * @brief Stream buffer that discards everything, so print() is measured without I/O.
+ */
+class NullBuffer : public std::streambuf
+{
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char *, std::streamsize n) override { return n; }
+};
+
+static bool firstResult = true;
+static volatile std::size_t blackHole; // Keeps lookup results observable so they are not optimized away
+
+static void emit(const char *type, const char *operation, std::size_t size, std::size_t ops, const Measurement &m)
+{
+    std::printf("%s\n    {\"type\": \"%s\", \"operation\": \"%s\", \"size\": %zu, \"ops\": %zu, "
+                "\"ns_per_op\": %.3f, \"allocs_per_op\": %.4f, \"peak_rss_kb\": %ld}",
+                firstResult ? "" : ",", type, operation, size, ops, m.nsPerOp, m.allocsPerOp, peakRssKilobytes());
+    firstResult = false;
+}
+
+template <typename T>
+static void fill(List<T> &list, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; i++)
+    {
+        list.insertAtTail(makeValue<T>(i));
+    }
+}
+
+template <typename T>
+static void run(const char *type, std::size_t size)
+{
+    std::mt19937_64 rng(size);
+    std::vector<T> values;
+    values.reserve(size);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        values.push_back(makeValue<T>(i));
+    }
+    // Operations that walk the list get a budget of about 10^7 hops per measurement
+    std::size_t walks = size > 10000000 ? 1 : (10000000 / size < 1000 ? 10000000 / size : 1000);
+
+    {
+        List<T> list;
+        emit(type, "insertAtTail", size, size, measure(size, [&]() {
+                 for (const T &value : values)
+                 {
+                     list.insertAtTail(value);
+                 }
+             }));
+    }
+    {
+        List<T> list;
+        emit(type, "insertAtFront", size, size, measure(size, [&]() {
+                 for (const T &value : values)
+                 {
+                     list.insertAtFront(value);
+                 }
+             }));
+    }
+
+    List<T> list;
+    fill(list, size);
+
+    emit(type, "insertAfter(random)", size, walks, measure(walks, [&]() {
+             for (std::size_t i = 0; i < walks; i++)
+             {
+                 ListItr<T> itr = list.first();
+                 for (std::size_t steps = rng() % size; steps > 0; steps--)
+                 {
+                     itr.moveForward();
+                 }
+                 list.insertAfter(values[i % size], itr);
+             }
+         }));
+
+    std::size_t found = 0;
+    emit(type, "find(hit)", size, walks, measure(walks, [&]() {
+             for (std::size_t i = 0; i < walks; i++)
+             {
+                 found += !list.find(values[rng() % size]).isPastEnd();
+             }
+         }));
+
+    T missing = makeValue<T>(size + 1);
+    emit(type, "find(miss)", size, walks, measure(walks, [&]() {
+             for (std::size_t i = 0; i < walks; i++)
+             {
+                 found += !list.find(missing).isPastEnd();
+             }
+         }));
+
+    std::size_t removals = walks < size ? walks : size;
+    emit(type, "remove", size, removals, measure(removals, [&]() {
+             for (std::size_t i = 0; i < removals; i++)
+             {
+                 list.remove(values[rng() % size]);
+             }
+         }));
+
+    std::size_t elements = static_cast<std::size_t>(list.size());
+    {
+        emit(type, "copy constructor (incl. destroy)", size, elements, measure(elements, [&]() {
+                 List<T> copy(list);
+                 found += copy.size();
+             }));
+    }
+    {
+        List<T> target;
+        fill(target, size / 2);
+        emit(type, "operator=", size, elements, measure(elements, [&]() { target = list; }));
+    }
+
+    NullBuffer discard;
+    std::ostream sink(&discard);
+    emit(type, "print", size, elements, measure(elements, [&]() { list.print(sink, true); }));
+
+    emit(type, "makeEmpty", size, elements, measure(elements, [&]() { list.makeEmpty(); }));
+
+    blackHole = found;
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t maxSize = maxSizeArgument(argc, argv, 1000000);
+
+    std::printf("{\n  \"benchmark\": \"ListBench\",\n  \"max_size\": %zu,\n  \"results\": [", maxSize);
+    for (std::size_t size : powersOfTen(1, maxSize))
+    {
+        run<int>("int", size);
+        run<Pod64>("pod64", size);
+        run<std::string>("string", size);
+    }
+    std::printf("\n  ]\n}\n");
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include <cstdio>
+#include <memory>
+#include <random>
+
+#include "../src/List.h"
+#include "BenchUtil.h"
+
+// Times two workloads on List<int> without statistics (NoListStats) and with CountingListStats, then prints
+// the counters of the counted run as JSON. The lookup workload shows long find walks (a case for a hash index),
+// the churn workload shows one allocation and one free per operation (a case for a pool or an arena).
+// Usage: ListStatsBench [maxSize]
+
+template <typename ListType>
+static Measurement lookups(ListType &list, std::size_t size, std::size_t operations)
+{
+    std::mt19937 random(7);
+    std::uniform_int_distribution<int> key(0, static_cast<int>(size) - 1);
+    long long sum = 0;
+    Measurement m = measure(operations, [&]() {
+        for (std::size_t i = 0; i < operations; i++)
+        {
+            ListItr<int> found = list.find(key(random));
+            sum += found.isPastEnd() ? 0 : found.retrieve();
+        }
+    });
+    if (sum == 42)
+    {
+        std::printf("\n");
+    }
+    return m;
+}
+
+template <typename ListType>
+static Measurement churn(ListType &list, std::size_t size)
+{
+    return measure(size, [&]() {
+        for (std::size_t i = 0; i < size; i++)
+        {
+            list.insertAtFront(-1);
+            list.remove(-1);
+            list.remove(-2);
+        }
+    });
+}
+
+template <typename Stats>
+static void run(const char *policy, std::size_t size, bool printStats)
+{
+    List<int, std::allocator<int>, Stats> lookupList;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        lookupList.insertAtTail(static_cast<int>(i));
+    }
+    // Each find walks half the list on average, so the lookup run makes only size / 10 of them
+    Measurement found = lookups(lookupList, size, size / 10);
+    std::printf("%-8s %-16s %10zu %10.2f ns/op\n", "lookup", policy, size, found.nsPerOp);
+    if (printStats)
+    {
+        std::printf("%s\n", lookupList.statistics().toJson().c_str());
+    }
+
+    List<int, std::allocator<int>, Stats> churnList;
+    Measurement churned = churn(churnList, size);
+    std::printf("%-8s %-16s %10zu %10.2f ns/op\n", "churn", policy, size, churned.nsPerOp);
+    if (printStats)
+    {
+        std::printf("%s\n", churnList.statistics().toJson().c_str());
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t maxSize = maxSizeArgument(argc, argv, 10000);
+    for (std::size_t size : powersOfTen(3, maxSize))
+    {
+        run<NoListStats>("NoListStats", size, false);
+        run<CountingListStats>("Counting", size, true);
+    }
+    return 0;
+}
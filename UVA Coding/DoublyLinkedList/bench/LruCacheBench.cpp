@@ -0,0 +1,108 @@
+#include <cstdio>
+#include <unordered_map>
+
+#include "../src/List.h"
+#include "../src/LruCache.h"
+#include "BenchUtil.h"
+
+// Replays Zipfian key streams against LruCache and against the remove + insertAtFront
+// List-based LRU it replaces. Every miss is followed by a put, as a read-through cache does.
+// Usage: LruCacheBench [keyCount]
+
+/**
+ * @brief The hand-rolled LRU: a List<int> of keys in recency order next to a key -> value map.
+ */
+class ListLru
+{
+public:
+    explicit ListLru(std::size_t capacity) : hits(0), misses(0), limit(capacity) {}
+
+    void access(int key)
+    {
+        if (values.count(key) != 0)
+        {
+            hits++;
+            recency.remove(key);
+            recency.insertAtFront(key);
+            return;
+        }
+
+        misses++;
+        if (values.size() >= limit)
+        {
+            int victim = recency.last().retrieve();
+            recency.remove(victim);
+            values.erase(victim);
+        }
+        recency.insertAtFront(key);
+        values[key] = key;
+    }
+
+    std::size_t hits;
+    std::size_t misses;
+
+private:
+    std::size_t limit;
+    List<int> recency;
+    std::unordered_map<int, int> values;
+};
+
+static void report(const char *cache, double exponent, std::size_t keys, std::size_t capacity, double hitRate, const Measurement &m)
+{
+    std::printf("%-9s zipf=%.1f keys=%-9zu capacity=%-8zu hit rate %6.2f%% %10.2f ns/op %8.3f allocs/op\n",
+                cache, exponent, keys, capacity, hitRate * 100.0, m.nsPerOp, m.allocsPerOp);
+}
+
+static std::vector<int> stream(std::size_t keys, double exponent, std::size_t length)
+{
+    ZipfGenerator zipf(keys, exponent, 42);
+    std::vector<int> result(length);
+    for (int &key : result)
+    {
+        key = static_cast<int>(zipf.next());
+    }
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t keys = maxSizeArgument(argc, argv, 100000);
+    const double exponents[] = {0.8, 1.0, 1.2};
+
+    for (double exponent : exponents)
+    {
+        std::vector<int> accesses = stream(keys, exponent, 1000000);
+        for (std::size_t capacity = keys / 1000 < 10 ? 10 : keys / 1000; capacity <= keys / 10; capacity *= 10)
+        {
+            LruCache<int, int> cache(capacity);
+            for (std::size_t i = 0; i < capacity; i++)
+            {
+                cache.put(accesses[i % accesses.size()], 0);
+            }
+            cache.resetStats();
+            Measurement m = measure(accesses.size(), [&]() {
+                for (int key : accesses)
+                {
+                    if (cache.get(key) == nullptr)
+                    {
+                        cache.put(key, key);
+                    }
+                }
+            });
+            LruCacheStats stats = cache.stats();
+            report("LruCache", exponent, keys, capacity, static_cast<double>(stats.hits) / accesses.size(), m);
+
+            // The List-based LRU is O(capacity) per hit, so it only gets a slice of the stream at large capacities
+            std::size_t slice = capacity > 1000 ? accesses.size() / 20 : accesses.size();
+            ListLru baseline(capacity);
+            Measurement b = measure(slice, [&]() {
+                for (std::size_t i = 0; i < slice; i++)
+                {
+                    baseline.access(accesses[i]);
+                }
+            });
+            report("List LRU", exponent, keys, capacity, static_cast<double>(baseline.hits) / slice, b);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,83 @@
+#include <cstdio>
+#include <string>
+
+#include <unistd.h>
+
+#include "../src/List.h"
+#include "../src/MappedList.h"
+#include "BenchUtil.h"
+
+// Compares reopening a MappedList with reloading a List snapshot, and times MappedList inserts and traversal.
+// Usage: MappedListBench [maxSize]   (files are written under /tmp and removed afterwards)
+
+static void report(const char *operation, std::size_t size, const Measurement &m, double total)
+{
+    std::printf("%-22s %10zu %10.2f ns/elem %8.3f allocs/elem %12.3f ms total\n", operation, size, m.nsPerOp,
+                m.allocsPerOp, total);
+}
+
+static double totalMilliseconds(const Measurement &m, std::size_t size)
+{
+    return m.nsPerOp * static_cast<double>(size) / 1e6;
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t maxSize = maxSizeArgument(argc, argv, 1000000);
+    const std::string mappedPath = "/tmp/MappedListBench." + std::to_string(::getpid()) + ".dll";
+    const std::string snapshotPath = "/tmp/MappedListBench." + std::to_string(::getpid()) + ".bin";
+    long long sum = 0;
+
+    for (std::size_t size : powersOfTen(4, maxSize))
+    {
+        std::remove(mappedPath.c_str());
+        {
+            MappedList<long long> mapped(mappedPath);
+            Measurement m = measure(size, [&]() {
+                for (std::size_t i = 0; i < size; i++)
+                {
+                    mapped.insertAtTail(static_cast<long long>(i));
+                }
+            });
+            report("MappedList insert", size, m, totalMilliseconds(m, size));
+            mapped.sync();
+
+            List<long long> list;
+            for (std::size_t i = 0; i < size; i++)
+            {
+                list.insertAtTail(static_cast<long long>(i));
+            }
+            list.save(snapshotPath);
+        }
+
+        Measurement open = measure(size, [&]() {
+            MappedList<long long> mapped(mappedPath);
+            sum += mapped.first().retrieve();
+        });
+        report("MappedList reopen", size, open, totalMilliseconds(open, size));
+
+        Measurement load = measure(size, [&]() {
+            List<long long> list;
+            list.load(snapshotPath);
+            sum += list.first().retrieve();
+        });
+        report("List load", size, load, totalMilliseconds(load, size));
+
+        MappedList<long long> mapped(mappedPath);
+        Measurement traversal = measure(size, [&]() {
+            for (long long value : mapped)
+            {
+                sum += value;
+            }
+        });
+        report("MappedList traverse", size, traversal, totalMilliseconds(traversal, size));
+    }
+
+    std::remove(mappedPath.c_str());
+    std::remove(snapshotPath.c_str());
+    if (sum == 42)
+    {
+        std::printf("\n");
+    }
+    return 0;
+}
@@ -0,0 +1,84 @@
+#include <cstdio>
+#include <memory_resource>
+#include <numeric>
+#include <vector>
+
+#include "../src/List.h"
+#include "BenchUtil.h"
+
+// Compares List<T> with new/delete nodes against List<T> backed by a ListNodePool and pmr::List<T> backed by a
+// monotonic_buffer_resource over a preallocated buffer (which never frees, so its memory only grows).
+// Usage: NodePoolBench [maxSize]
+
+static void report(const char *operation, std::size_t size, const char *mode, const Measurement &m)
+{
+    std::printf("%-14s %10zu %-8s %10.2f ns/op %8.3f allocs/op\n", operation, size, mode, m.nsPerOp, m.allocsPerOp);
+}
+
+template <typename ListType>
+static void fill(ListType &list, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; i++)
+    {
+        list.insertAtTail(static_cast<int>(i));
+    }
+}
+
+template <typename ListType>
+static void run(ListType &list, std::size_t size, const char *mode)
+{
+    report("insertAtTail", size, mode, measure(size, [&]() { fill(list, size); }));
+
+    long long sum = 0;
+    Measurement traversal = measure(size, [&]() {
+        for (ListItr<int> itr = list.first(); !itr.isPastEnd(); itr.moveForward())
+        {
+            sum += itr.retrieve();
+        }
+    });
+    report("traverse", size, mode, traversal);
+
+    report("front churn", size, mode, measure(size, [&]() {
+               for (std::size_t i = 0; i < size; i++)
+               {
+                   list.insertAtFront(-1);
+                   list.remove(-1);
+               }
+           }));
+
+    report("makeEmpty", size, mode, measure(size, [&]() { list.makeEmpty(); }));
+
+    std::vector<int> values(size);
+    std::iota(values.begin(), values.end(), 0);
+    report("assign range", size, mode, measure(size, [&]() { list.assign(values.begin(), values.end()); }));
+    report("removeIf half", size, mode, measure(size, [&]() {
+               sum += list.removeIf([](int value) { return value % 2 != 0; });
+           }));
+    list.makeEmpty();
+
+    if (sum == 42)
+    {
+        std::printf("\n");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t maxSize = maxSizeArgument(argc, argv, 1000000);
+    for (std::size_t size : powersOfTen(3, maxSize))
+    {
+        List<int> plain;
+        run(plain, size, "new");
+
+        ListNodePool<int> pool(4096);
+        List<int> pooled(pool);
+        run(pooled, size, "pool");
+
+        // Room for every node the run creates: fill, churn and assign each make `size` nodes
+        std::vector<unsigned char> buffer(4 * size * sizeof(ListNode<int>) + 4096);
+        std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+        ::pmr::List<int> arenaList(&arena);
+        run(arenaList, size, "pmr");
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "../src/List.h"
+#include "../src/PersistentList.h"
+#include "BenchUtil.h"
+
+// Compares keeping a history of list versions as PersistentList<int> versions against full List<int> copies.
+// Each version is one edit of the previous one: a push at the front, an insert in the middle, or a removal at the front.
+// Reports heap bytes per version kept and the latency of producing one version.
+// Usage: PersistentListBench [maxSize]   (list sizes run from 10^3 up to maxSize)
+
+static void report(const char *container, const char *edit, std::size_t size, std::size_t versions, double bytesPerVersion,
+                   const Measurement &m)
+{
+    std::printf("%-15s %-8s %9zu %6zu versions %14.1f B/version %12.1f ns/version %8.2f allocs/version\n", container, edit,
+                size, versions, bytesPerVersion, m.nsPerOp, m.allocsPerOp);
+}
+
+template <typename History, typename Edit>
+static void run(const char *container, const char *edit, std::size_t size, std::size_t versions, const History &base,
+                Edit makeVersion)
+{
+    std::vector<History> history;
+    history.reserve(versions + 1);
+    history.push_back(base);
+
+    std::uint64_t heapBefore = heapBytesInUse();
+    Measurement m = measure(versions, [&]() {
+        for (std::size_t v = 0; v < versions; v++)
+        {
+            history.push_back(makeVersion(history.back(), v));
+        }
+    });
+    double bytesPerVersion = static_cast<double>(heapBytesInUse() - heapBefore) / static_cast<double>(versions);
+    report(container, edit, size, versions, bytesPerVersion, m);
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t maxSize = maxSizeArgument(argc, argv, 100000);
+    for (std::size_t size : powersOfTen(3, maxSize))
+    {
+        // Keep the List copies to about 10^7 nodes in total
+        std::size_t versions = std::min<std::size_t>(1000, 10000000 / size);
+        List<int> list;
+        PersistentList<int> persistent;
+        for (std::size_t i = 0; i < size; i++)
+        {
+            list.insertAtTail(static_cast<int>(i));
+            persistent = persistent.insertAtFront(static_cast<int>(size - 1 - i));
+        }
+        int middle = static_cast<int>(size / 2);
+
+        run("List copy", "front", size, versions, list, [](const List<int> &previous, std::size_t v) {
+            List<int> next(previous);
+            next.insertAtFront(static_cast<int>(v));
+            return next;
+        });
+        run("PersistentList", "front", size, versions, persistent, [](const PersistentList<int> &previous, std::size_t v) {
+            return previous.insertAtFront(static_cast<int>(v));
+        });
+
+        run("List copy", "middle", size, versions, list, [middle](const List<int> &previous, std::size_t v) {
+            List<int> next(previous);
+            next.insertBefore(static_cast<int>(v), next.find(middle));
+            return next;
+        });
+        run("PersistentList", "middle", size, versions, persistent,
+            [middle](const PersistentList<int> &previous, std::size_t v) {
+                return previous.insertBefore(static_cast<int>(v), previous.find(middle));
+            });
+
+        run("List copy", "pop", size, versions, list, [](const List<int> &previous, std::size_t) {
+            List<int> next(previous);
+            next.remove(next.first().retrieve());
+            return next;
+        });
+        run("PersistentList", "pop", size, versions, persistent, [](const PersistentList<int> &previous, std::size_t) {
+            return previous.removeFirst();
+        });
+    }
+    return 0;
+}
@@ -0,0 +1,94 @@
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "../src/List.h"
+#include "../src/PositionalList.h"
+#include "BenchUtil.h"
+
+// Times random positional operations on PositionalList<int> against walking a List<int> with ListItr.
+// Usage: PositionalBench [maxSize]   (sizes run from 10^6 up to maxSize, e.g. 10000000)
+
+static void report(const char *operation, const char *container, std::size_t size, const Measurement &m)
+{
+    std::printf("%-10s %-15s %10zu %12.1f ns/op %8.3f allocs/op\n", operation, container, size, m.nsPerOp, m.allocsPerOp);
+}
+
+static void run(std::size_t size)
+{
+    std::mt19937 rng(static_cast<unsigned>(size));
+    int n = static_cast<int>(size);
+    const std::size_t ops = 100000;
+    long long sum = 0;
+
+    PositionalList<int> positional;
+    for (int i = 0; i < n; i++)
+    {
+        positional.insertAtTail(i);
+    }
+
+    report("at", "PositionalList", size, measure(ops, [&]() {
+               for (std::size_t i = 0; i < ops; i++)
+               {
+                   sum += positional.at(static_cast<int>(rng() % size));
+               }
+           }));
+    report("insertAt", "PositionalList", size, measure(ops, [&]() {
+               for (std::size_t i = 0; i < ops; i++)
+               {
+                   positional.insertAt(static_cast<int>(rng() % (size + 1)), -1);
+               }
+           }));
+    report("eraseAt", "PositionalList", size, measure(ops, [&]() {
+               for (std::size_t i = 0; i < ops; i++)
+               {
+                   positional.eraseAt(static_cast<int>(rng() % size));
+               }
+           }));
+
+    std::vector<PositionalListItr<int>> positions;
+    for (std::size_t i = 0; i < ops; i++)
+    {
+        positions.push_back(positional.itrAt(static_cast<int>(rng() % size)));
+    }
+    report("indexOf", "PositionalList", size, measure(ops, [&]() {
+               for (const PositionalListItr<int> &position : positions)
+               {
+                   sum += positional.indexOf(position);
+               }
+           }));
+
+    // The walk this replaces: O(k) per lookup, so only a handful of operations are timed
+    List<int> list;
+    for (int i = 0; i < n; i++)
+    {
+        list.insertAtTail(i);
+    }
+    const std::size_t walks = 20;
+    report("at", "List (walk)", size, measure(walks, [&]() {
+               for (std::size_t i = 0; i < walks; i++)
+               {
+                   ListItr<int> itr = list.first();
+                   for (std::size_t steps = rng() % size; steps > 0; steps--)
+                   {
+                       itr.moveForward();
+                   }
+                   sum += itr.retrieve();
+               }
+           }));
+
+    if (sum == 42)
+    {
+        std::printf("\n");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t maxSize = maxSizeArgument(argc, argv, 1000000);
+    for (std::size_t size : powersOfTen(6, maxSize))
+    {
+        run(size);
+    }
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "../src/List.h"
+#include "../src/SelfOrganizingList.h"
+#include "BenchUtil.h"
+
+// Replays Zipfian lookup streams against List::find over insertion order and against SelfOrganizingList with
+// each policy, reporting the average and longest walk per find and the time per find. The keys are inserted in
+// a shuffled order, so the popular ones are not already near the head.
+// Usage: SelfOrganizingBench [keyCount]
+
+static void report(const char *method, double exponent, std::size_t keys, const ListStatsSnapshot &stats, const Measurement &m)
+{
+    std::printf("%-14s zipf=%.1f keys=%-7zu %9.2f hops/find %7llu max hops %10.2f ns/find %6.3f allocs/find\n", method,
+                exponent, keys, stats.averageFindHops(), static_cast<unsigned long long>(stats.maxFindHops), m.nsPerOp,
+                m.allocsPerOp);
+}
+
+template <typename ListType>
+static void replay(const char *method, double exponent, const std::vector<int> &order, const std::vector<int> &accesses)
+{
+    ListType list;
+    for (int key : order)
+    {
+        list.insertAtTail(key);
+    }
+    long long found = 0;
+    Measurement m = measure(accesses.size(), [&]() {
+        for (int key : accesses)
+        {
+            found += list.find(key) != nullptr;
+        }
+    });
+    report(method, exponent, order.size(), list.statistics(), m);
+    if (found == 42)
+    {
+        std::printf("\n");
+    }
+}
+
+/**
+ * @brief List::find as it is today, behind the pointer-returning interface of SelfOrganizingList.
+ */
+class PlainFind
+{
+public:
+    void insertAtTail(int key)
+    {
+        list.insertAtTail(key);
+    }
+
+    int *find(int key)
+    {
+        ListItr<int> hit = list.find(key);
+        return hit.isPastEnd() ? nullptr : &hit.retrieve();
+    }
+
+    ListStatsSnapshot statistics() const
+    {
+        return list.statistics();
+    }
+
+private:
+    List<int, std::allocator<int>, CountingListStats> list;
+};
+
+int main(int argc, char **argv)
+{
+    std::size_t keys = maxSizeArgument(argc, argv, 1000);
+    std::vector<int> order(keys);
+    for (std::size_t i = 0; i < keys; i++)
+    {
+        order[i] = static_cast<int>(i);
+    }
+    std::shuffle(order.begin(), order.end(), std::mt19937(3));
+
+    const double exponents[] = {0.8, 1.0, 1.2};
+    for (double exponent : exponents)
+    {
+        ZipfGenerator zipf(keys, exponent, 42);
+        std::vector<int> accesses(200000);
+        for (int &key : accesses)
+        {
+            key = static_cast<int>(zipf.next());
+        }
+
+        replay<PlainFind>("List::find", exponent, order, accesses);
+        replay<SelfOrganizingList<int, MoveToFrontPolicy, CountingListStats>>("move-to-front", exponent, order, accesses);
+        replay<SelfOrganizingList<int, TransposePolicy, CountingListStats>>("transpose", exponent, order, accesses);
+        replay<SelfOrganizingList<int, CountPolicy, CountingListStats>>("count", exponent, order, accesses);
+    }
+    return 0;
+}
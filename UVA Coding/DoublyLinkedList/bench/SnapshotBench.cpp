@@ -0,0 +1,66 @@
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+#include "../src/List.h"
+#include "BenchUtil.h"
+
+// Compares List<T>::save/load with the text round trip through print() and insertAtTail.
+// Usage: SnapshotBench [maxSize]
+
+static void report(const char *method, const char *type, std::size_t size, const Measurement &m, std::size_t bytes)
+{
+    std::printf("%-16s %-7s %10zu %10.2f ns/elem %8.3f allocs/elem %12zu bytes\n", method, type, size, m.nsPerOp,
+                m.allocsPerOp, bytes);
+}
+
+template <typename T, typename Make>
+static void run(const char *type, std::size_t size, Make make)
+{
+    List<T> list;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        list.insertAtTail(make(i));
+    }
+
+    std::ostringstream text;
+    Measurement printed = measure(size, [&]() { list.print(text, true); });
+    report("print", type, size, printed, text.str().size());
+
+    Measurement parsed = measure(size, [&]() {
+        std::istringstream in(text.str());
+        List<T> reloaded;
+        T value;
+        while (in >> value)
+        {
+            reloaded.insertAtTail(value);
+        }
+    });
+    report("parse+insert", type, size, parsed, text.str().size());
+
+    std::ostringstream binary;
+    Measurement saved = measure(size, [&]() { list.save(binary); });
+    report("save", type, size, saved, binary.str().size());
+
+    std::istringstream in(binary.str());
+    List<T> reloaded;
+    Measurement loaded = measure(size, [&]() { reloaded.load(in); });
+    report("load", type, size, loaded, binary.str().size());
+
+    ListNodePool<T> pool;
+    List<T> pooled(pool);
+    std::istringstream pooledIn(binary.str());
+    Measurement pooledLoad = measure(size, [&]() { pooled.load(pooledIn); });
+    report("load (pool)", type, size, pooledLoad, binary.str().size());
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t maxSize = maxSizeArgument(argc, argv, 1000000);
+    for (std::size_t size : powersOfTen(4, maxSize))
+    {
+        run<int>("int", size, [](std::size_t i) { return static_cast<int>(i * 2654435761u); });
+        run<std::string>("string", size, [](std::size_t i) { return "record-" + std::to_string(i); });
+    }
+    return 0;
+}
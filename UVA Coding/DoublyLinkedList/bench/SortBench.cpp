@@ -0,0 +1,81 @@
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "../src/List.h"
+#include "BenchUtil.h"
+
+// Compares the in-place List<T>::sort against copying the values out, std::sort-ing them and rebuilding the list.
+// Usage: SortBench [maxSize]   (sizes run from 10^6 up to maxSize, e.g. 100000000)
+
+static void report(const char *method, const char *input, std::size_t size, const Measurement &m, const List<int> &list)
+{
+    bool sorted = std::is_sorted(list.begin(), list.end());
+    std::printf("%-22s %-8s %10zu %10.2f ns/elem %8.3f allocs/elem %s\n", method, input, size, m.nsPerOp, m.allocsPerOp,
+                sorted ? "" : "NOT SORTED");
+}
+
+static void fill(List<int> &list, std::size_t size, bool shuffled)
+{
+    std::mt19937 rng(static_cast<unsigned>(size));
+    for (std::size_t i = 0; i < size; i++)
+    {
+        list.insertAtTail(shuffled ? static_cast<int>(rng()) : static_cast<int>(i));
+    }
+}
+
+// Each method sorts a list built in a fresh node pool, so every method starts with its nodes laid out
+// in allocation order rather than inheriting the scattered order of nodes freed by the method before it.
+static void run(const char *input, std::size_t size, bool shuffled)
+{
+    {
+        ListNodePool<int> pool;
+        List<int> list(pool);
+        fill(list, size, shuffled);
+        Measurement m = measure(size, [&]() { list.sort(); });
+        report("List::sort", input, size, m, list);
+    }
+
+    {
+        // The copy-out baseline as it had to be written before sort(): a vector of values and a new list of new nodes
+        ListNodePool<int> pool;
+        List<int> list(pool);
+        fill(list, size, shuffled);
+        Measurement m = measure(size, [&]() {
+            std::vector<int> values(list.begin(), list.end());
+            std::sort(values.begin(), values.end());
+            List<int> rebuilt;
+            for (int value : values)
+            {
+                rebuilt.insertAtTail(value);
+            }
+            list = std::move(rebuilt);
+        });
+        report("copy/std::sort/rebuild", input, size, m, list);
+    }
+
+    {
+        // Best case for copying out: the nodes are kept and the sorted values are written back into them
+        ListNodePool<int> pool;
+        List<int> list(pool);
+        fill(list, size, shuffled);
+        Measurement m = measure(size, [&]() {
+            std::vector<int> values(list.begin(), list.end());
+            std::sort(values.begin(), values.end());
+            std::copy(values.begin(), values.end(), list.begin());
+        });
+        report("copy/std::sort/assign", input, size, m, list);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t maxSize = maxSizeArgument(argc, argv, 1000000);
+    for (std::size_t size : powersOfTen(6, maxSize))
+    {
+        run("random", size, true);
+        run("sorted", size, false);
+    }
+    return 0;
+}
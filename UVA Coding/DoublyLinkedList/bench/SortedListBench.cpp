@@ -0,0 +1,137 @@
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "../src/List.h"
+#include "../src/SortedList.h"
+#include "BenchUtil.h"
+
+// Times keeping random keys in order with SortedList<int>, std::set<int> and a List<int> kept sorted
+// by a scan followed by insertBefore.
+// Usage: SortedListBench [maxSize]   (sizes run from 10^4 up to maxSize, default 10^6)
+
+static void report(const char *operation, const char *container, std::size_t size, const Measurement &m)
+{
+    std::printf("%-10s %-15s %10zu %12.1f ns/op %8.3f allocs/op\n", operation, container, size, m.nsPerOp, m.allocsPerOp);
+}
+
+static void run(std::size_t size)
+{
+    std::mt19937 rng(static_cast<unsigned>(size));
+    const int rangeWidth = 200; // About 100 keys per range query, since the keys are the even numbers
+    const std::size_t ops = 100000;
+    long long sum = 0;
+
+    std::vector<int> keys(size);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        keys[i] = static_cast<int>(2 * i);
+    }
+    std::shuffle(keys.begin(), keys.end(), rng);
+    std::vector<int> probes(ops);
+    for (int &probe : probes)
+    {
+        probe = static_cast<int>(rng() % (2 * size - 1)); // Half hits, half misses, none past the largest key
+    }
+
+    SortedList<int> sorted;
+    report("insert", "SortedList", size, measure(size, [&]() {
+               for (int key : keys)
+               {
+                   sorted.insert(key);
+               }
+           }));
+    report("lowerBound", "SortedList", size, measure(ops, [&]() {
+               for (int probe : probes)
+               {
+                   sum += *sorted.lowerBound(probe) == probe;
+               }
+           }));
+    report("range", "SortedList", size, measure(ops, [&]() {
+               for (int probe : probes)
+               {
+                   for (int key : sorted.range(probe, probe + rangeWidth))
+                   {
+                       sum += key;
+                   }
+               }
+           }));
+    report("traverse", "SortedList", size, measure(size, [&]() { sum = std::accumulate(sorted.begin(), sorted.end(), sum); }));
+    report("erase", "SortedList", size, measure(size, [&]() {
+               for (int key : keys)
+               {
+                   sorted.erase(key);
+               }
+           }));
+
+    std::set<int> set;
+    report("insert", "std::set", size, measure(size, [&]() {
+               for (int key : keys)
+               {
+                   set.insert(key);
+               }
+           }));
+    report("lowerBound", "std::set", size, measure(ops, [&]() {
+               for (int probe : probes)
+               {
+                   sum += *set.lower_bound(probe) == probe;
+               }
+           }));
+    report("range", "std::set", size, measure(ops, [&]() {
+               for (int probe : probes)
+               {
+                   for (auto itr = set.lower_bound(probe), end = set.lower_bound(probe + rangeWidth); itr != end; ++itr)
+                   {
+                       sum += *itr;
+                   }
+               }
+           }));
+    report("traverse", "std::set", size, measure(size, [&]() { sum = std::accumulate(set.begin(), set.end(), sum); }));
+    report("erase", "std::set", size, measure(size, [&]() {
+               for (int key : keys)
+               {
+                   set.erase(key);
+               }
+           }));
+
+    // The pattern SortedList replaces: O(n) per operation, so it is only timed on the smallest size
+    // and its lookups on a slice of the probes
+    if (size <= 10000)
+    {
+        List<int> list;
+        report("insert", "List (scan)", size, measure(size, [&]() {
+                   for (int key : keys)
+                   {
+                       list.insertBefore(key, list.findIf([key](int value) { return !(value < key); }));
+                   }
+               }));
+        const std::size_t scans = ops / 100;
+        report("lowerBound", "List (scan)", size, measure(scans, [&]() {
+                   for (std::size_t i = 0; i < scans; i++)
+                   {
+                       int probe = probes[i];
+                       ListItr<int> itr = list.findIf([probe](int value) { return !(value < probe); });
+                       sum += itr.retrieve() == probe;
+                   }
+               }));
+        report("traverse", "List (scan)", size, measure(size, [&]() { sum = std::accumulate(list.begin(), list.end(), sum); }));
+    }
+
+    if (sum == 42)
+    {
+        std::printf("\n");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t maxSize = maxSizeArgument(argc, argv, 1000000);
+    for (std::size_t size : powersOfTen(4, maxSize))
+    {
+        run(size);
+    }
+    return 0;
+}
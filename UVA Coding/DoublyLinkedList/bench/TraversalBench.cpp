@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <cstdio>
+#include <new>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../src/List.h"
+#include "../src/UnrolledList.h"
+#include "BenchUtil.h"
+
+// Compares plain iterator loops with the prefetching traversal kernels (find, countIf, accumulate) on lists
+// whose nodes sit in memory in traversal order and on lists whose nodes are scattered.
+// Usage: TraversalBench [maxSize]
+
+static long long blackHole = 0;
+
+static void report(const char *container, const char *layout, const char *method, std::size_t size, const Measurement &m)
+{
+    std::printf("%-13s %-9s %-22s %10zu %8.2f ns/elem\n", container, layout, method, size, m.nsPerOp);
+}
+
+// Nodes are allocated holding a random permutation, then sort() relinks them into value order: the list
+// reads 0, 1, 2, ... but consecutive elements sit at random places in the pool.
+static void buildList(List<int> &list, std::size_t size, bool scattered)
+{
+    std::vector<int> values(size);
+    std::iota(values.begin(), values.end(), 0);
+    if (scattered)
+    {
+        std::shuffle(values.begin(), values.end(), std::mt19937(42));
+    }
+    list.assign(values.begin(), values.end());
+    list.sort();
+}
+
+// Same for strings long enough to live on the heap, so each element costs a node load plus a character load
+static void buildStringList(List<std::string> &list, std::size_t size, bool scattered)
+{
+    std::vector<std::string> values(size);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        char key[64];
+        std::snprintf(key, sizeof(key), "record-%012zu-with-a-heap-allocated-key", i);
+        values[i] = key;
+    }
+    if (scattered)
+    {
+        std::shuffle(values.begin(), values.end(), std::mt19937(42));
+    }
+    list.assign(values.begin(), values.end());
+    list.sort();
+}
+
+// Chunks are scattered by first handing the allocator chunk-sized blocks back in random order.
+template <typename Chunk, typename Unrolled>
+static void buildUnrolled(Unrolled &list, std::size_t size, bool scattered)
+{
+    if (scattered)
+    {
+        std::vector<void *> blocks(size / 8 + 1);
+        for (void *&block : blocks)
+        {
+            block = ::operator new(sizeof(Chunk), std::align_val_t(alignof(Chunk)));
+        }
+        std::shuffle(blocks.begin(), blocks.end(), std::mt19937(42));
+        for (void *block : blocks)
+        {
+            ::operator delete(block, std::align_val_t(alignof(Chunk)));
+        }
+    }
+    for (std::size_t i = 0; i < size; i++)
+    {
+        list.insertAtTail(static_cast<int>(i));
+    }
+}
+
+// Best of five runs, since a single pass over a scattered list is at the mercy of everything else on the machine
+template <typename Body>
+static Measurement bestOf(std::size_t size, Body body)
+{
+    Measurement best = measure(size, body);
+    for (int round = 1; round < 5; round++)
+    {
+        Measurement m = measure(size, body);
+        if (m.nsPerOp < best.nsPerOp)
+        {
+            best = m;
+        }
+    }
+    return best;
+}
+
+template <typename Container>
+static void run(const char *name, const char *layout, Container &list, std::size_t size)
+{
+    const int missing = -1;
+    report(name, layout, "std::find (iterators)", size, bestOf(size, [&]() {
+               blackHole += std::find(list.begin(), list.end(), missing) == list.end();
+           }));
+    report(name, layout, "find (kernel)", size, bestOf(size, [&]() { blackHole += list.find(missing).isPastEnd(); }));
+    report(name, layout, "std::accumulate", size, bestOf(size, [&]() {
+               blackHole += std::accumulate(list.begin(), list.end(), 0LL);
+           }));
+    report(name, layout, "accumulate (kernel)", size, bestOf(size, [&]() { blackHole += list.accumulate(0LL); }));
+    report(name, layout, "countIf (kernel)", size, bestOf(size, [&]() {
+               blackHole += list.countIf([](int value) { return (value & 3) == 0; });
+           }));
+}
+
+static void runStrings(const char *layout, List<std::string> &list, std::size_t size)
+{
+    const std::string missing = "record-999999999999-with-a-heap-allocated-key";
+    report("List<string>", layout, "std::find (iterators)", size, bestOf(size, [&]() {
+               blackHole += std::find(list.begin(), list.end(), missing) == list.end();
+           }));
+    report("List<string>", layout, "find (kernel)", size, bestOf(size, [&]() {
+               blackHole += list.find(missing).isPastEnd();
+           }));
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t maxSize = maxSizeArgument(argc, argv, 1000000);
+    for (std::size_t size : powersOfTen(4, maxSize))
+    {
+        for (bool scattered : {false, true})
+        {
+            const char *layout = scattered ? "scattered" : "in-order";
+            {
+                ListNodePool<int> pool;
+                List<int> list(pool);
+                buildList(list, size, scattered);
+                run("List", layout, list, size);
+            }
+            {
+                ListNodePool<std::string> pool;
+                List<std::string> list(pool);
+                buildStringList(list, size, scattered);
+                runStrings(layout, list, size);
+            }
+            {
+                UnrolledList<int> list;
+                buildUnrolled<UnrolledListNode<int, unrolledDefaultCapacity<int>()>>(list, size, scattered);
+                run("UnrolledList", layout, list, size);
+            }
+        }
+    }
+    if (blackHole == 42)
+    {
+        std::printf("\n");
+    }
+    return 0;
+}
@@ -0,0 +1,66 @@
+#include <cstdio>
+
+#include "../src/List.h"
+#include "../src/UnrolledList.h"
+#include "BenchUtil.h"
+
+// Compares UnrolledList<T> against List<T> for traversal, find and middle insert.
+// Usage: UnrolledBench [maxSize]   (sizes run from 10^3 up to maxSize, e.g. 100000000)
+
+static void report(const char *operation, const char *type, std::size_t size, const char *container, const Measurement &m)
+{
+    std::printf("%-14s %-7s %10zu %-13s %10.2f ns/op %8.3f allocs/op\n", operation, type, size, container, m.nsPerOp, m.allocsPerOp);
+}
+
+template <typename ListType, typename T>
+static void run(const char *container, const char *type, std::size_t size)
+{
+    ListType list;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        list.insertAtTail(static_cast<T>(i));
+    }
+
+    T sum = 0;
+    report("traverse", type, size, container, measure(size, [&]() {
+               for (const T &value : list)
+               {
+                   sum += value;
+               }
+           }));
+
+    std::size_t lookups = size >= 1000000 ? 4 : 16;
+    report("find", type, size, container, measure(lookups * size / 2, [&]() {
+               for (std::size_t i = 0; i < lookups; i++)
+               {
+                   sum += list.find(static_cast<T>(size / 2)).retrieve();
+               }
+           }));
+
+    // Each middle insert pays for walking to the middle, which is what dominates in practice
+    std::size_t inserts = size >= 1000000 ? 4 : 64;
+    report("middle insert", type, size, container, measure(inserts, [&]() {
+               for (std::size_t i = 0; i < inserts; i++)
+               {
+                   list.insertAfter(static_cast<T>(-1), list.find(static_cast<T>(size / 2)));
+               }
+           }));
+
+    if (sum == static_cast<T>(-42))
+    {
+        std::printf("\n");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t maxSize = maxSizeArgument(argc, argv, 1000000);
+    for (std::size_t size : powersOfTen(3, maxSize))
+    {
+        run<List<int>, int>("List", "int", size);
+        run<UnrolledList<int>, int>("UnrolledList", "int", size);
+        run<List<double>, double>("List", "double", size);
+        run<UnrolledList<double>, double>("UnrolledList", "double", size);
+    }
+    return 0;
+}
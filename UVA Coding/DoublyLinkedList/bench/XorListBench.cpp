@@ -0,0 +1,78 @@
+#include <cstdint>
+#include <cstdio>
+
+#include "../src/CompactList.h"
+#include "../src/List.h"
+#include "../src/XorList.h"
+#include "BenchUtil.h"
+
+// Compares the memory footprint and speed of XorList<T> and CompactList<T> against List<T> (with new/delete and with a node pool).
+// CompactList grows its node array by doubling, so its bytes per element include up to half an array of spare slots.
+// Usage: XorListBench [maxSize]   (sizes run from 10^3 up to maxSize, e.g. 100000000)
+
+static void report(const char *container, const char *type, std::size_t size, std::size_t valueBytes, double bytesPerElement,
+                   const Measurement &insert, const Measurement &traverse)
+{
+    std::printf("%-15s %-9s %10zu %7.2f B/elem %7.2f B/elem overhead %8.2f ns/insert %6.2f ns/elem traverse\n", container, type,
+                size, bytesPerElement, bytesPerElement - static_cast<double>(valueBytes), insert.nsPerOp, traverse.nsPerOp);
+}
+
+template <typename ListType, typename T>
+static void run(const char *container, const char *type, std::size_t size, ListType &list)
+{
+    std::uint64_t heapBefore = heapBytesInUse();
+    Measurement insert = measure(size, [&]() {
+        for (std::size_t i = 0; i < size; i++)
+        {
+            list.insertAtTail(static_cast<T>(i));
+        }
+    });
+    double bytesPerElement = static_cast<double>(heapBytesInUse() - heapBefore) / static_cast<double>(size);
+
+    T sum = 0;
+    Measurement traverse = measure(size, [&]() {
+        for (const T &value : list)
+        {
+            sum += value;
+        }
+    });
+    report(container, type, size, sizeof(T), bytesPerElement, insert, traverse);
+
+    if (sum == static_cast<T>(-42))
+    {
+        std::printf("\n");
+    }
+}
+
+template <typename T>
+static void runAll(const char *type, std::size_t size)
+{
+    {
+        List<T> list;
+        run<List<T>, T>("List", type, size, list);
+    }
+    {
+        ListNodePool<T> pool;
+        List<T> list(pool);
+        run<List<T>, T>("List+NodePool", type, size, list);
+    }
+    {
+        XorList<T> list;
+        run<XorList<T>, T>("XorList", type, size, list);
+    }
+    {
+        CompactList<T> list;
+        run<CompactList<T>, T>("CompactList", type, size, list);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t maxSize = maxSizeArgument(argc, argv, 1000000);
+    for (std::size_t size : powersOfTen(3, maxSize))
+    {
+        runAll<int>("int", size);
+        runAll<long long>("long long", size);
+    }
+    return 0;
+}
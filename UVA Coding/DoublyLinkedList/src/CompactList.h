@@ -0,0 +1,947 @@
+#ifndef COMPACTLIST_H
+#define COMPACTLIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+template <typename T>
+class CompactList;
+
+/**
+ * @class CompactListNode
+ * @brief A slot of the node array of a CompactList: two 32-bit links and raw storage for one value.
+ *
+ * Slots 0 and 1 are the dummy head and tail and never hold a value. A free slot holds no value and
+ * uses `next` to link to the next free slot.
+ */
+template <typename T>
+class CompactListNode
+{
+private:
+    /**
+     * @brief Returns the value stored in the slot.
+     *
+     * @return Pointer to the value.
+     */
+    T *value() const;
+
+    std::uint32_t next;                          /**< Index of the next slot in the list (or in the free list). */
+    std::uint32_t previous;                      /**< Index of the previous slot in the list. */
+    alignas(T) unsigned char storage[sizeof(T)]; /**< Storage for the value. */
+
+    template <typename, bool>
+    friend class CompactListItr; /**< CompactListItr needs access to the value and links. */
+    friend class CompactList<T>; /**< CompactList needs access to the value and links. */
+};
+
+/**
+ * @class CompactListItr
+ * @brief Position in a CompactList: the list plus a slot index.
+ *
+ * Offers both the ListItr vocabulary (moveForward, retrieve, isPastEnd, ...) and the standard
+ * bidirectional iterator operators. Because it stores an index rather than an address, a position
+ * stays valid when the node array grows; only erasing its element or compact() invalidates it.
+ */
+template <typename T, bool IsConst = false>
+class CompactListItr
+{
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::conditional<IsConst, const T *, T *>::type;
+    using reference = typename std::conditional<IsConst, const T &, T &>::type;
+    using ListType = typename std::conditional<IsConst, const CompactList<T>, CompactList<T>>::type;
+
+    /**
+     * @brief Default constructor.
+     *
+     * Constructs a CompactListItr that belongs to no list.
+     */
+    CompactListItr();
+
+    /**
+     * @brief Constructor for a given list and slot.
+     *
+     * @param theList The list the position belongs to.
+     * @param theIndex The slot index of the position.
+     */
+    CompactListItr(ListType *theList, std::uint32_t theIndex);
+
+    /**
+     * @brief Converts a mutable position into a read-only one.
+     *
+     * @param other The position to convert.
+     */
+    template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+    CompactListItr(const CompactListItr<T, OtherConst> &other);
+
+    /**
+     * @brief Checks if the iterator is past the end position (on the dummy tail).
+     *
+     * @return True if the iterator is past the end position, false otherwise.
+     */
+    bool isPastEnd() const;
+
+    /**
+     * @brief Checks if the iterator is past the beginning position (on the dummy head).
+     *
+     * @return True if the iterator is past the beginning position, false otherwise.
+     */
+    bool isPastBeginning() const;
+
+    /**
+     * @brief Advances to the next element, unless already past the end.
+     */
+    void moveForward();
+
+    /**
+     * @brief Moves back to the previous element, unless already past the beginning.
+     */
+    void moveBackward();
+
+    /**
+     * @brief Retrieves the value at the current position.
+     *
+     * @return Reference to the value at the current position.
+     */
+    reference retrieve() const;
+
+    /** @brief Standard iterator access to the value at the current position, without checks. */
+    reference operator*() const;
+    pointer operator->() const;
+
+    /** @brief Standard iterator movement, without bounds checks. */
+    CompactListItr &operator++();
+    CompactListItr operator++(int);
+    CompactListItr &operator--();
+    CompactListItr operator--(int);
+
+    /** @brief Checks whether two iterators point to the same slot. */
+    template <bool OtherConst>
+    bool operator==(const CompactListItr<T, OtherConst> &other) const;
+
+    /** @brief Checks whether two iterators point to different slots. */
+    template <bool OtherConst>
+    bool operator!=(const CompactListItr<T, OtherConst> &other) const;
+
+private:
+    ListType *list;      /**< The list the position belongs to. */
+    std::uint32_t index; /**< Slot index of the position. */
+
+    friend class CompactList<T>;              /**< CompactList needs access to the position. */
+    friend class CompactListItr<T, !IsConst>; /**< Conversions and comparisons need access. */
+};
+
+/**
+ * @class CompactList
+ * @brief Doubly linked list whose nodes live in one growable array and link to each other by 32-bit index.
+ *
+ * Offers the List API (dummy head and tail, insertBefore/insertAfter, find, remove, traversal in both
+ * directions) with half the link overhead of ListNode pointers on a 64-bit machine and no per-node
+ * heap allocation. Freed slots go on an intrusive free list and are reused first; compact() renumbers
+ * the nodes into traversal order so that a walk over the list becomes a sequential scan. Since links
+ * are indices, the node array of a list of trivially copyable values is relocatable with one memcpy,
+ * which is how such lists are copied. A list holds at most 2^32 - 3 elements.
+ */
+template <typename T>
+class CompactList
+{
+public:
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = CompactListItr<T>;
+    using const_iterator = CompactListItr<T, true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /**
+     * @brief Default constructor.
+     *
+     * Sets up the dummy head and tail slots.
+     */
+    CompactList();
+
+    /**
+     * @brief Copy constructor.
+     *
+     * For trivially copyable T the node array is copied with one memcpy, so the copy has the same layout
+     * as `source`; otherwise the elements are copied in traversal order.
+     * @param source The source CompactList to be copied.
+     */
+    CompactList(const CompactList &source);
+
+    /**
+     * @brief Move constructor.
+     *
+     * Takes over the node array of `source`, leaving it a working empty list.
+     * @param source The source CompactList to be moved from.
+     */
+    CompactList(CompactList &&source);
+
+    /**
+     * @brief Destructor.
+     */
+    ~CompactList();
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * @param source The right-hand-side CompactList to be copied.
+     * @return Reference to the current list.
+     */
+    CompactList &operator=(const CompactList &source);
+
+    /**
+     * @brief Move assignment operator.
+     *
+     * @param source The right-hand-side CompactList to be moved from.
+     * @return Reference to the current list.
+     */
+    CompactList &operator=(CompactList &&source);
+
+    /**
+     * @brief Checks if the list is empty.
+     *
+     * @return True if the list is empty, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Removes all elements. The node array keeps its capacity.
+     *
+     * O(1) when T is trivially destructible, since no node needs to be visited.
+     */
+    void makeEmpty();
+
+    /**
+     * @brief Returns an iterator to the first element (past the end if the list is empty).
+     *
+     * @return CompactListItr pointing to the first element.
+     */
+    iterator first();
+
+    /**
+     * @brief Returns an iterator to the last element (past the beginning if the list is empty).
+     *
+     * @return CompactListItr pointing to the last element.
+     */
+    iterator last();
+
+    /**
+     * @brief Inserts a value after the given position.
+     *
+     * @param x The value to be inserted.
+     * @param position The position to insert after.
+     */
+    void insertAfter(const T &x, iterator position);
+
+    /**
+     * @brief Inserts a value before the given position.
+     *
+     * @param x The value to be inserted.
+     * @param position The position to insert before.
+     */
+    void insertBefore(const T &x, iterator position);
+
+    /**
+     * @brief Inserts a value at the tail of the list.
+     *
+     * @param x The value to be inserted.
+     */
+    void insertAtTail(const T &x);
+
+    /**
+     * @brief Inserts a value at the front of the list.
+     *
+     * @param x The value to be inserted.
+     */
+    void insertAtFront(const T &x);
+
+    /**
+     * @brief Returns an iterator to the first occurrence of a value, or past the end if it is not found.
+     *
+     * @param x The value to search for.
+     * @return CompactListItr pointing to the first occurrence of the value.
+     */
+    iterator find(const T &x);
+
+    /**
+     * @brief Removes the first occurrence of a value from the list.
+     *
+     * @param x The value to be removed.
+     */
+    void remove(const T &x);
+
+    /**
+     * @brief Removes the element at the given position and puts its slot on the free list.
+     *
+     * @param position The position of the element to be removed.
+     * @return CompactListItr pointing to the element that followed the removed one.
+     */
+    iterator erase(iterator position);
+
+    /**
+     * @brief Returns the number of elements in the list.
+     *
+     * @return The number of elements in the list.
+     */
+    int size() const;
+
+    /**
+     * @brief Returns the number of slots the node array has room for, including the dummy head and tail.
+     *
+     * @return The capacity in slots.
+     */
+    std::size_t capacity() const;
+
+    /**
+     * @brief Grows the node array so that it holds at least `elements` elements without reallocating.
+     *
+     * @param elements The number of elements to make room for.
+     */
+    void reserve(std::size_t elements);
+
+    /**
+     * @brief Renumbers the nodes into traversal order and shrinks the node array to fit.
+     *
+     * Afterwards the k-th element sits in slot k + 2 and the free list is empty.
+     * Invalidates every iterator into the list.
+     */
+    void compact();
+
+    /**
+     * @brief Prints the contents of the list forwards (head -> tail) or backwards (tail -> head).
+     *
+     * @param os The output stream to which the list is printed.
+     * @param forward True to print forwards, false to print backwards.
+     */
+    void print(std::ostream &os = std::cout, bool forward = true);
+
+    /** @brief Standard iterator access, as on List; end() is the dummy tail. */
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+    reverse_iterator rbegin();
+    reverse_iterator rend();
+
+private:
+    using Node = CompactListNode<T>;
+
+    static const std::uint32_t headIndex = 0; // Slot of the dummy head
+    static const std::uint32_t tailIndex = 1; // Slot of the dummy tail
+    static const std::uint32_t noSlot = 0;    // End of the free list (slot 0 is never free)
+
+    /**
+     * @brief Takes a slot from the free list, or the next unused slot, growing the array if needed.
+     *
+     * @return The index of an empty slot.
+     */
+    std::uint32_t allocateSlot();
+
+    /**
+     * @brief Constructs `x` in a new slot and links it between two adjacent slots.
+     *
+     * @param x The value to be inserted.
+     * @param before The slot that will precede the new one.
+     * @param after The slot that will follow the new one.
+     */
+    void insertBetween(const T &x, std::uint32_t before, std::uint32_t after);
+
+    /**
+     * @brief Moves every slot into a new, larger array at the same index, so indices stay valid.
+     *
+     * @param newCapacity The number of slots of the new array; more than capacity().
+     */
+    void grow(std::uint32_t newCapacity);
+
+    /**
+     * @brief Moves the elements into a new array of `newCapacity` slots, in traversal order from slot 2 on.
+     *
+     * @param newCapacity The number of slots of the new array; at least size() + 2.
+     */
+    void relocate(std::uint32_t newCapacity);
+
+    /**
+     * @brief Destroys every value and releases the node array.
+     */
+    void release();
+
+    /**
+     * @brief Allocates a node array with the dummy head and tail linked to each other.
+     *
+     * @param slotCount The number of slots; at least 2.
+     */
+    void initialize(std::uint32_t slotCount);
+
+    Node *nodes;             // The node array; slots 0 and 1 are the dummy head and tail
+    std::uint32_t slotLimit; // Number of slots in the array
+    std::uint32_t used;      // Slots [0, used) have been handed out at least once
+    std::uint32_t freeSlots; // First slot of the free list, or noSlot
+    int count;               // Number of elements in the list
+
+    template <typename, bool>
+    friend class CompactListItr; /**< CompactListItr follows links through the node array. */
+};
+
+template <typename T>
+T *CompactListNode<T>::value() const
+{
+    return std::launder(reinterpret_cast<T *>(const_cast<unsigned char *>(storage)));
+}
+
+template <typename T, bool IsConst>
+CompactListItr<T, IsConst>::CompactListItr()
+{
+    list = nullptr;
+    index = 0;
+}
+
+template <typename T, bool IsConst>
+CompactListItr<T, IsConst>::CompactListItr(ListType *theList, std::uint32_t theIndex)
+{
+    list = theList;
+    index = theIndex;
+}
+
+template <typename T, bool IsConst>
+template <bool OtherConst, typename>
+CompactListItr<T, IsConst>::CompactListItr(const CompactListItr<T, OtherConst> &other)
+{
+    list = other.list;
+    index = other.index;
+}
+
+template <typename T, bool IsConst>
+bool CompactListItr<T, IsConst>::isPastEnd() const
+{
+    return index == CompactList<T>::tailIndex;
+}
+
+template <typename T, bool IsConst>
+bool CompactListItr<T, IsConst>::isPastBeginning() const
+{
+    return index == CompactList<T>::headIndex;
+}
+
+template <typename T, bool IsConst>
+void CompactListItr<T, IsConst>::moveForward()
+{
+    if (list != nullptr && !isPastEnd())
+    {
+        index = list->nodes[index].next;
+    }
+}
+
+template <typename T, bool IsConst>
+void CompactListItr<T, IsConst>::moveBackward()
+{
+    if (list != nullptr && !isPastBeginning())
+    {
+        index = list->nodes[index].previous;
+    }
+}
+
+template <typename T, bool IsConst>
+typename CompactListItr<T, IsConst>::reference CompactListItr<T, IsConst>::retrieve() const
+{
+    if (list == nullptr || isPastEnd() || isPastBeginning())
+    {
+        throw std::runtime_error("Attempt to retrieve from a position without an element");
+    }
+    return *list->nodes[index].value();
+}
+
+template <typename T, bool IsConst>
+typename CompactListItr<T, IsConst>::reference CompactListItr<T, IsConst>::operator*() const
+{
+    return *list->nodes[index].value();
+}
+
+template <typename T, bool IsConst>
+typename CompactListItr<T, IsConst>::pointer CompactListItr<T, IsConst>::operator->() const
+{
+    return list->nodes[index].value();
+}
+
+template <typename T, bool IsConst>
+CompactListItr<T, IsConst> &CompactListItr<T, IsConst>::operator++()
+{
+    index = list->nodes[index].next;
+    return *this;
+}
+
+template <typename T, bool IsConst>
+CompactListItr<T, IsConst> CompactListItr<T, IsConst>::operator++(int)
+{
+    CompactListItr<T, IsConst> old = *this;
+    index = list->nodes[index].next;
+    return old;
+}
+
+template <typename T, bool IsConst>
+CompactListItr<T, IsConst> &CompactListItr<T, IsConst>::operator--()
+{
+    index = list->nodes[index].previous;
+    return *this;
+}
+
+template <typename T, bool IsConst>
+CompactListItr<T, IsConst> CompactListItr<T, IsConst>::operator--(int)
+{
+    CompactListItr<T, IsConst> old = *this;
+    index = list->nodes[index].previous;
+    return old;
+}
+
+template <typename T, bool IsConst>
+template <bool OtherConst>
+bool CompactListItr<T, IsConst>::operator==(const CompactListItr<T, OtherConst> &other) const
+{
+    return list == other.list && index == other.index;
+}
+
+template <typename T, bool IsConst>
+template <bool OtherConst>
+bool CompactListItr<T, IsConst>::operator!=(const CompactListItr<T, OtherConst> &other) const
+{
+    return !(*this == other);
+}
+
+template <typename T>
+CompactList<T>::CompactList()
+{
+    initialize(16);
+}
+
+template <typename T>
+CompactList<T>::CompactList(const CompactList<T> &source)
+{
+    if (std::is_trivially_copyable<T>::value)
+    {
+        // Indices do not care where the array lives, so the whole list is one block copy
+        nodes = new Node[source.slotLimit];
+        std::memcpy(static_cast<void *>(nodes), source.nodes, source.used * sizeof(Node));
+        slotLimit = source.slotLimit;
+        used = source.used;
+        freeSlots = source.freeSlots;
+        count = source.count;
+    }
+    else
+    {
+        initialize(source.count + 2);
+        for (const T &value : source)
+        {
+            insertAtTail(value);
+        }
+    }
+}
+
+template <typename T>
+CompactList<T>::CompactList(CompactList<T> &&source) : CompactList()
+{
+    std::swap(nodes, source.nodes);
+    std::swap(slotLimit, source.slotLimit);
+    std::swap(used, source.used);
+    std::swap(freeSlots, source.freeSlots);
+    std::swap(count, source.count);
+}
+
+template <typename T>
+CompactList<T>::~CompactList()
+{
+    release();
+}
+
+template <typename T>
+CompactList<T> &CompactList<T>::operator=(const CompactList<T> &source)
+{
+    if (this != &source)
+    {
+        CompactList<T> copy(source);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+template <typename T>
+CompactList<T> &CompactList<T>::operator=(CompactList<T> &&source)
+{
+    if (this != &source)
+    {
+        makeEmpty();
+        std::swap(nodes, source.nodes);
+        std::swap(slotLimit, source.slotLimit);
+        std::swap(used, source.used);
+        std::swap(freeSlots, source.freeSlots);
+        std::swap(count, source.count);
+    }
+    return *this;
+}
+
+template <typename T>
+bool CompactList<T>::isEmpty() const
+{
+    return count == 0;
+}
+
+template <typename T>
+void CompactList<T>::makeEmpty()
+{
+    if (!std::is_trivially_destructible<T>::value)
+    {
+        for (std::uint32_t slot = nodes[headIndex].next; slot != tailIndex; slot = nodes[slot].next)
+        {
+            nodes[slot].value()->~T();
+        }
+    }
+    nodes[headIndex].next = tailIndex;
+    nodes[tailIndex].previous = headIndex;
+    used = 2;
+    freeSlots = noSlot;
+    count = 0;
+}
+
+template <typename T>
+typename CompactList<T>::iterator CompactList<T>::first()
+{
+    return iterator(this, nodes[headIndex].next);
+}
+
+template <typename T>
+typename CompactList<T>::iterator CompactList<T>::last()
+{
+    return iterator(this, nodes[tailIndex].previous);
+}
+
+template <typename T>
+void CompactList<T>::insertAfter(const T &x, iterator position)
+{
+    if (position.isPastEnd())
+    {
+        throw std::invalid_argument("Cannot insert after the end of the list.");
+    }
+    insertBetween(x, position.index, nodes[position.index].next);
+}
+
+template <typename T>
+void CompactList<T>::insertBefore(const T &x, iterator position)
+{
+    if (position.isPastBeginning())
+    {
+        throw std::invalid_argument("Cannot insert before the beginning of the list.");
+    }
+    insertBetween(x, nodes[position.index].previous, position.index);
+}
+
+template <typename T>
+void CompactList<T>::insertAtTail(const T &x)
+{
+    insertBetween(x, nodes[tailIndex].previous, tailIndex);
+}
+
+template <typename T>
+void CompactList<T>::insertAtFront(const T &x)
+{
+    insertBetween(x, headIndex, nodes[headIndex].next);
+}
+
+template <typename T>
+typename CompactList<T>::iterator CompactList<T>::find(const T &x)
+{
+    std::uint32_t slot = nodes[headIndex].next;
+    while (slot != tailIndex && *nodes[slot].value() != x)
+    {
+        slot = nodes[slot].next;
+    }
+    return iterator(this, slot);
+}
+
+template <typename T>
+void CompactList<T>::remove(const T &x)
+{
+    iterator itr = find(x);
+    if (!itr.isPastEnd())
+    {
+        erase(itr);
+    }
+}
+
+template <typename T>
+typename CompactList<T>::iterator CompactList<T>::erase(iterator position)
+{
+    if (position.isPastEnd() || position.isPastBeginning())
+    {
+        throw std::invalid_argument("Cannot erase a dummy head or tail node.");
+    }
+
+    Node &node = nodes[position.index];
+    std::uint32_t next = node.next;
+    nodes[node.previous].next = next;
+    nodes[next].previous = node.previous;
+    node.value()->~T();
+    node.next = freeSlots;
+    freeSlots = position.index;
+    count--;
+    return iterator(this, next);
+}
+
+template <typename T>
+int CompactList<T>::size() const
+{
+    return count;
+}
+
+template <typename T>
+std::size_t CompactList<T>::capacity() const
+{
+    return slotLimit;
+}
+
+template <typename T>
+void CompactList<T>::reserve(std::size_t elements)
+{
+    if (elements + 2 > 0xFFFFFFFFu)
+    {
+        throw std::length_error("CompactList cannot hold that many elements.");
+    }
+    if (elements + 2 > slotLimit)
+    {
+        grow(static_cast<std::uint32_t>(elements + 2));
+    }
+}
+
+template <typename T>
+void CompactList<T>::compact()
+{
+    relocate(static_cast<std::uint32_t>(count) + 2);
+}
+
+template <typename T>
+void CompactList<T>::print(std::ostream &os, bool forward)
+{
+    if (forward)
+    {
+        for (iterator itr = first(); !itr.isPastEnd(); itr.moveForward())
+        {
+            os << itr.retrieve() << " ";
+        }
+    }
+    else
+    {
+        for (iterator itr = last(); !itr.isPastBeginning(); itr.moveBackward())
+        {
+            os << itr.retrieve() << " ";
+        }
+    }
+    os << std::endl;
+}
+
+template <typename T>
+typename CompactList<T>::iterator CompactList<T>::begin()
+{
+    return first();
+}
+
+template <typename T>
+typename CompactList<T>::iterator CompactList<T>::end()
+{
+    return iterator(this, tailIndex);
+}
+
+template <typename T>
+typename CompactList<T>::const_iterator CompactList<T>::begin() const
+{
+    return const_iterator(this, nodes[headIndex].next);
+}
+
+template <typename T>
+typename CompactList<T>::const_iterator CompactList<T>::end() const
+{
+    return const_iterator(this, tailIndex);
+}
+
+template <typename T>
+typename CompactList<T>::reverse_iterator CompactList<T>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <typename T>
+typename CompactList<T>::reverse_iterator CompactList<T>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template <typename T>
+std::uint32_t CompactList<T>::allocateSlot()
+{
+    if (freeSlots != noSlot)
+    {
+        std::uint32_t slot = freeSlots;
+        freeSlots = nodes[slot].next;
+        return slot;
+    }
+    if (used == slotLimit)
+    {
+        if (slotLimit == 0xFFFFFFFFu)
+        {
+            throw std::length_error("CompactList cannot hold that many elements.");
+        }
+        std::uint64_t grown = static_cast<std::uint64_t>(slotLimit) * 2;
+        grow(grown > 0xFFFFFFFFu ? 0xFFFFFFFFu : static_cast<std::uint32_t>(grown));
+    }
+    return used++;
+}
+
+template <typename T>
+void CompactList<T>::insertBetween(const T &x, std::uint32_t before, std::uint32_t after)
+{
+    // Copy first: `x` may live in the node array, which allocateSlot() can move
+    T copy(x);
+    std::uint32_t slot = allocateSlot();
+    Node &node = nodes[slot];
+    try
+    {
+        new (node.storage) T(std::move(copy));
+    }
+    catch (...)
+    {
+        node.next = freeSlots;
+        freeSlots = slot;
+        throw;
+    }
+
+    node.previous = before;
+    node.next = after;
+    nodes[before].next = slot;
+    nodes[after].previous = slot;
+    count++;
+}
+
+template <typename T>
+void CompactList<T>::grow(std::uint32_t newCapacity)
+{
+    Node *fresh = new Node[newCapacity];
+    if (std::is_trivially_copyable<T>::value)
+    {
+        std::memcpy(static_cast<void *>(fresh), nodes, used * sizeof(Node));
+    }
+    else
+    {
+        // Free slots and the dummy head and tail only need their links
+        for (std::uint32_t slot = 0; slot < used; slot++)
+        {
+            fresh[slot].next = nodes[slot].next;
+            fresh[slot].previous = nodes[slot].previous;
+        }
+        std::uint32_t slot = nodes[headIndex].next;
+        try
+        {
+            for (; slot != tailIndex; slot = nodes[slot].next)
+            {
+                new (fresh[slot].storage) T(std::move_if_noexcept(*nodes[slot].value()));
+            }
+        }
+        catch (...)
+        {
+            for (std::uint32_t built = nodes[headIndex].next; built != slot; built = nodes[built].next)
+            {
+                fresh[built].value()->~T();
+            }
+            delete[] fresh;
+            throw;
+        }
+    }
+
+    release();
+    nodes = fresh;
+    slotLimit = newCapacity;
+}
+
+template <typename T>
+void CompactList<T>::relocate(std::uint32_t newCapacity)
+{
+    Node *fresh = new Node[newCapacity];
+    std::uint32_t slot = nodes[headIndex].next;
+    std::uint32_t target = 2;
+    try
+    {
+        for (; slot != tailIndex; slot = nodes[slot].next, target++)
+        {
+            new (fresh[target].storage) T(std::move_if_noexcept(*nodes[slot].value()));
+            fresh[target].previous = target - 1;
+            fresh[target].next = target + 1;
+        }
+    }
+    catch (...)
+    {
+        for (std::uint32_t built = 2; built < target; built++)
+        {
+            fresh[built].value()->~T();
+        }
+        delete[] fresh;
+        throw;
+    }
+
+    fresh[headIndex].previous = headIndex;
+    fresh[headIndex].next = count == 0 ? tailIndex : 2;
+    fresh[tailIndex].next = tailIndex;
+    fresh[tailIndex].previous = count == 0 ? headIndex : target - 1;
+    if (count > 0)
+    {
+        fresh[2].previous = headIndex;
+        fresh[target - 1].next = tailIndex;
+    }
+
+    release();
+    nodes = fresh;
+    slotLimit = newCapacity;
+    used = target;
+    freeSlots = noSlot;
+}
+
+template <typename T>
+void CompactList<T>::release()
+{
+    if (nodes == nullptr)
+    {
+        return;
+    }
+    if (!std::is_trivially_destructible<T>::value)
+    {
+        for (std::uint32_t slot = nodes[headIndex].next; slot != tailIndex; slot = nodes[slot].next)
+        {
+            nodes[slot].value()->~T();
+        }
+    }
+    delete[] nodes;
+    nodes = nullptr;
+}
+
+template <typename T>
+void CompactList<T>::initialize(std::uint32_t slotCount)
+{
+    nodes = new Node[slotCount];
+    slotLimit = slotCount;
+    nodes[headIndex].previous = headIndex;
+    nodes[headIndex].next = tailIndex;
+    nodes[tailIndex].previous = headIndex;
+    nodes[tailIndex].next = tailIndex;
+    used = 2;
+    freeSlots = noSlot;
+    count = 0;
+}
+
+#endif
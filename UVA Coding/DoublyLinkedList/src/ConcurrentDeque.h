@@ -0,0 +1,645 @@
+#ifndef CONCURRENTDEQUE_H
+#define CONCURRENTDEQUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Tests define this to pause a pop between reading an end node's link and swinging the anchor
+#ifndef CONCURRENTDEQUE_PAUSE
+#define CONCURRENTDEQUE_PAUSE()
+#endif
+
+/**
+ * @class ConcurrentDeque
+ * @brief Lock-free double-ended queue for many producers and many consumers.
+ *
+ * This is Maged Michael's CAS-based deque ("CAS-Based Lock-Free Algorithm for Shared Deques", 2003).
+ * The two ends of the deque live in a single 64-bit anchor word holding the leftmost node, the
+ * rightmost node and a status; the anchor plays the role of List's dummy head and tail, which a
+ * single-word CAS cannot update together. A push swings the anchor to the new node and then
+ * "stabilizes" by pointing the old end node back at it; any thread that finds the deque unstable
+ * finishes that step first, so no thread ever waits on another.
+ *
+ * Nodes live in a segmented arena and are named by 31-bit indices so that both ends fit in one
+ * CAS-able word. Popped nodes are reclaimed with hazard pointers: a node is only recycled once no
+ * thread that might still read its links has it published as hazardous. The anchor has no room for a
+ * version tag, so a pop publishes both ends of the anchor it read; neither index can then be reissued,
+ * which keeps that anchor word from recurring (ABA) before the pop's CAS. Per-operation state
+ * (hazard pointers and the retired list) is kept in one of `kSlots` cache-line-sized slots that each
+ * operation claims on entry, so the deque is lock-free for up to `kSlots` concurrent threads.
+ */
+template <typename T>
+class ConcurrentDeque
+{
+public:
+    static constexpr std::size_t kSlots = 128; /**< Upper bound on threads operating at the same time. */
+
+    /**
+     * @brief Default constructor.
+     *
+     * Creates an empty deque. Node storage is requested on demand.
+     */
+    ConcurrentDeque();
+
+    /**
+     * @brief Destructor.
+     *
+     * Destroys the remaining values. No other thread may be using the deque.
+     */
+    ~ConcurrentDeque();
+
+    ConcurrentDeque(const ConcurrentDeque &) = delete;
+    ConcurrentDeque &operator=(const ConcurrentDeque &) = delete;
+
+    /**
+     * @brief Inserts a value at the front (left end).
+     *
+     * @param x The value to be inserted.
+     */
+    void pushFront(T x);
+
+    /**
+     * @brief Inserts a value at the back (right end).
+     *
+     * @param x The value to be inserted.
+     */
+    void pushBack(T x);
+
+    /**
+     * @brief Removes the value at the front (left end).
+     *
+     * @param out Receives the value if one was removed.
+     * @return True if a value was removed, false if the deque was empty.
+     */
+    bool popFront(T &out);
+
+    /**
+     * @brief Removes the value at the back (right end).
+     *
+     * @param out Receives the value if one was removed.
+     * @return True if a value was removed, false if the deque was empty.
+     */
+    bool popBack(T &out);
+
+    /**
+     * @brief Checks if the deque is empty at the moment of the call.
+     *
+     * @return True if the deque holds no values.
+     */
+    bool isEmpty() const;
+
+private:
+    using Index = std::uint32_t;
+
+    static constexpr Index kNull = 0;                           // Index 0 is never a node
+    static constexpr std::uint64_t kIndexMask = 0x7fffffff;     // Anchor ends are 31-bit indices
+    static constexpr std::uint64_t kStable = 0;                 // Both end nodes are fully linked
+    static constexpr std::uint64_t kRightPush = 1;              // The right end's predecessor still needs its right link
+    static constexpr std::uint64_t kLeftPush = 2;               // The left end's successor still needs its left link
+    static constexpr std::size_t kFirstSegment = 1024;          // Nodes in segment 0; each segment doubles
+    static constexpr std::size_t kSegments = 22;                // Enough segments for 2^31 nodes
+    static constexpr std::size_t kRetireThreshold = 4 * kSlots; // Twice the hazard count, so a scan frees at least half
+
+    // A deque node; `storage` holds a value only between its push and its pop
+    struct Node
+    {
+        std::atomic<Index> left;
+        std::atomic<Index> right; // Also the free-list link while the node is free
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T *value() { return std::launder(reinterpret_cast<T *>(storage)); }
+    };
+
+    // Per-operation reclamation state, claimed by one thread at a time
+    struct alignas(64) Slot
+    {
+        std::atomic<bool> inUse;
+        std::atomic<Index> hazards[2];
+        std::vector<Index> retired; // Only touched by the thread holding the slot
+    };
+
+    // Unpacked form of the anchor word
+    struct Anchor
+    {
+        Index left;
+        Index right;
+        std::uint64_t status;
+    };
+
+    static std::uint64_t pack(Index left, Index right, std::uint64_t status);
+    static Anchor unpack(std::uint64_t word);
+
+    static std::size_t segmentOf(Index index);
+    Node &node(Index index) const;
+    Index allocateNode();
+    void freeNode(Index index);
+
+    Slot &acquireSlot();
+    void releaseSlot(Slot &slot);
+    void retire(Slot &slot, Index index);
+    void scan(Slot &slot);
+
+    void stabilize(Slot &slot, std::uint64_t word);
+    void stabilizeRight(Slot &slot, std::uint64_t word);
+    void stabilizeLeft(Slot &slot, std::uint64_t word);
+
+    alignas(64) std::atomic<std::uint64_t> anchor;   // [left | right | status] of the deque
+    alignas(64) std::atomic<std::uint64_t> freeList; // [tag | index] of the first free node
+    alignas(64) std::atomic<Index> nextUnused;       // First index never handed out
+    std::atomic<Node *> segments[kSegments];         // Lazily allocated arena segments
+    Slot slots[kSlots];                              // Hazard pointers and retired lists
+};
+
+template <typename T>
+ConcurrentDeque<T>::ConcurrentDeque()
+{
+    anchor.store(pack(kNull, kNull, kStable));
+    freeList.store(0);
+    nextUnused.store(1);
+    for (std::atomic<Node *> &segment : segments)
+    {
+        segment.store(nullptr);
+    }
+    for (Slot &slot : slots)
+    {
+        slot.inUse.store(false);
+        slot.hazards[0].store(kNull);
+        slot.hazards[1].store(kNull);
+    }
+}
+
+template <typename T>
+ConcurrentDeque<T>::~ConcurrentDeque()
+{
+    Anchor ends = unpack(anchor.load());
+    Index current = ends.left;
+    while (current != kNull)
+    {
+        Index next = current == ends.right ? kNull : node(current).right.load();
+        node(current).value()->~T();
+        current = next;
+    }
+
+    for (std::size_t s = 0; s < kSegments; s++)
+    {
+        Node *segment = segments[s].load();
+        if (segment != nullptr)
+        {
+            ::operator delete(segment);
+        }
+    }
+}
+
+template <typename T>
+void ConcurrentDeque<T>::pushFront(T x)
+{
+    Index created = allocateNode();
+    Node &fresh = node(created);
+    try
+    {
+        new (fresh.storage) T(std::move(x));
+    }
+    catch (...)
+    {
+        freeNode(created);
+        throw;
+    }
+    fresh.left.store(kNull, std::memory_order_relaxed);
+
+    // Claimed only once nothing else can throw, so a failed push never strands the slot
+    Slot &slot = acquireSlot();
+
+    while (true)
+    {
+        std::uint64_t word = anchor.load();
+        Anchor ends = unpack(word);
+        if (ends.left == kNull)
+        {
+            if (anchor.compare_exchange_weak(word, pack(created, created, kStable)))
+            {
+                break;
+            }
+        }
+        else if (ends.status == kStable)
+        {
+            fresh.right.store(ends.left);
+            std::uint64_t pushed = pack(created, ends.right, kLeftPush);
+            if (anchor.compare_exchange_weak(word, pushed))
+            {
+                stabilizeLeft(slot, pushed);
+                break;
+            }
+        }
+        else
+        {
+            stabilize(slot, word);
+        }
+    }
+    releaseSlot(slot);
+}
+
+template <typename T>
+void ConcurrentDeque<T>::pushBack(T x)
+{
+    Index created = allocateNode();
+    Node &fresh = node(created);
+    try
+    {
+        new (fresh.storage) T(std::move(x));
+    }
+    catch (...)
+    {
+        freeNode(created);
+        throw;
+    }
+    fresh.right.store(kNull, std::memory_order_relaxed);
+
+    // Claimed only once nothing else can throw, so a failed push never strands the slot
+    Slot &slot = acquireSlot();
+
+    while (true)
+    {
+        std::uint64_t word = anchor.load();
+        Anchor ends = unpack(word);
+        if (ends.right == kNull)
+        {
+            if (anchor.compare_exchange_weak(word, pack(created, created, kStable)))
+            {
+                break;
+            }
+        }
+        else if (ends.status == kStable)
+        {
+            fresh.left.store(ends.right);
+            std::uint64_t pushed = pack(ends.left, created, kRightPush);
+            if (anchor.compare_exchange_weak(word, pushed))
+            {
+                stabilizeRight(slot, pushed);
+                break;
+            }
+        }
+        else
+        {
+            stabilize(slot, word);
+        }
+    }
+    releaseSlot(slot);
+}
+
+template <typename T>
+bool ConcurrentDeque<T>::popFront(T &out)
+{
+    Slot &slot = acquireSlot();
+    Index popped;
+    while (true)
+    {
+        std::uint64_t word = anchor.load();
+        Anchor ends = unpack(word);
+        if (ends.left == kNull)
+        {
+            releaseSlot(slot);
+            return false;
+        }
+        if (ends.left == ends.right)
+        {
+            if (anchor.compare_exchange_weak(word, pack(kNull, kNull, ends.status)))
+            {
+                popped = ends.left;
+                break;
+            }
+        }
+        else if (ends.status == kStable)
+        {
+            slot.hazards[0].store(ends.left);
+            slot.hazards[1].store(ends.right);
+            if (anchor.load() != word)
+            {
+                continue;
+            }
+            Index next = node(ends.left).right.load();
+            CONCURRENTDEQUE_PAUSE();
+            if (anchor.compare_exchange_weak(word, pack(next, ends.right, kStable)))
+            {
+                popped = ends.left;
+                break;
+            }
+        }
+        else
+        {
+            stabilize(slot, word);
+        }
+    }
+
+    slot.hazards[0].store(kNull);
+    slot.hazards[1].store(kNull);
+    T *value = node(popped).value();
+    out = std::move(*value);
+    value->~T();
+    retire(slot, popped);
+    releaseSlot(slot);
+    return true;
+}
+
+template <typename T>
+bool ConcurrentDeque<T>::popBack(T &out)
+{
+    Slot &slot = acquireSlot();
+    Index popped;
+    while (true)
+    {
+        std::uint64_t word = anchor.load();
+        Anchor ends = unpack(word);
+        if (ends.right == kNull)
+        {
+            releaseSlot(slot);
+            return false;
+        }
+        if (ends.left == ends.right)
+        {
+            if (anchor.compare_exchange_weak(word, pack(kNull, kNull, ends.status)))
+            {
+                popped = ends.right;
+                break;
+            }
+        }
+        else if (ends.status == kStable)
+        {
+            slot.hazards[0].store(ends.right);
+            slot.hazards[1].store(ends.left);
+            if (anchor.load() != word)
+            {
+                continue;
+            }
+            Index previous = node(ends.right).left.load();
+            CONCURRENTDEQUE_PAUSE();
+            if (anchor.compare_exchange_weak(word, pack(ends.left, previous, kStable)))
+            {
+                popped = ends.right;
+                break;
+            }
+        }
+        else
+        {
+            stabilize(slot, word);
+        }
+    }
+
+    slot.hazards[0].store(kNull);
+    slot.hazards[1].store(kNull);
+    T *value = node(popped).value();
+    out = std::move(*value);
+    value->~T();
+    retire(slot, popped);
+    releaseSlot(slot);
+    return true;
+}
+
+template <typename T>
+bool ConcurrentDeque<T>::isEmpty() const
+{
+    return unpack(anchor.load()).left == kNull;
+}
+
+template <typename T>
+std::uint64_t ConcurrentDeque<T>::pack(Index left, Index right, std::uint64_t status)
+{
+    return (static_cast<std::uint64_t>(left) << 33) | (static_cast<std::uint64_t>(right) << 2) | status;
+}
+
+template <typename T>
+typename ConcurrentDeque<T>::Anchor ConcurrentDeque<T>::unpack(std::uint64_t word)
+{
+    Anchor ends;
+    ends.left = static_cast<Index>((word >> 33) & kIndexMask);
+    ends.right = static_cast<Index>((word >> 2) & kIndexMask);
+    ends.status = word & 3;
+    return ends;
+}
+
+template <typename T>
+std::size_t ConcurrentDeque<T>::segmentOf(Index index)
+{
+    // Segment s holds indices [kFirstSegment * (2^s - 1), kFirstSegment * (2^(s+1) - 1)), so s = floor(log2(index / kFirstSegment + 1))
+    std::uint32_t scaled = static_cast<std::uint32_t>(index / kFirstSegment + 1);
+#if defined(__GNUC__)
+    return static_cast<std::size_t>(31 - __builtin_clz(scaled));
+#else
+    std::size_t segment = 0;
+    while ((scaled >> (segment + 1)) != 0)
+    {
+        segment++;
+    }
+    return segment;
+#endif
+}
+
+template <typename T>
+typename ConcurrentDeque<T>::Node &ConcurrentDeque<T>::node(Index index) const
+{
+    std::size_t segment = segmentOf(index);
+    std::size_t offset = index - kFirstSegment * ((std::size_t(1) << segment) - 1);
+    return segments[segment].load(std::memory_order_acquire)[offset];
+}
+
+template <typename T>
+typename ConcurrentDeque<T>::Index ConcurrentDeque<T>::allocateNode()
+{
+    std::uint64_t top = freeList.load();
+    while (static_cast<Index>(top) != kNull)
+    {
+        Index candidate = static_cast<Index>(top);
+        Index next = node(candidate).right.load();
+        std::uint64_t popped = ((top >> 32) + 1) << 32 | next; // Bump the tag so a recycled top cannot ABA
+        if (freeList.compare_exchange_weak(top, popped))
+        {
+            return candidate;
+        }
+    }
+
+    Index fresh = nextUnused.fetch_add(1);
+    if (fresh > kIndexMask)
+    {
+        throw std::length_error("ConcurrentDeque node arena exhausted.");
+    }
+
+    std::size_t segment = segmentOf(fresh);
+    if (segments[segment].load(std::memory_order_acquire) == nullptr)
+    {
+        std::size_t nodes = kFirstSegment << segment;
+        Node *block = static_cast<Node *>(::operator new(nodes * sizeof(Node)));
+        for (std::size_t i = 0; i < nodes; i++)
+        {
+            new (&block[i].left) std::atomic<Index>(kNull);
+            new (&block[i].right) std::atomic<Index>(kNull);
+        }
+        Node *expected = nullptr;
+        if (!segments[segment].compare_exchange_strong(expected, block, std::memory_order_acq_rel))
+        {
+            ::operator delete(block);
+        }
+    }
+    return fresh;
+}
+
+template <typename T>
+void ConcurrentDeque<T>::freeNode(Index index)
+{
+    std::uint64_t top = freeList.load();
+    while (true)
+    {
+        node(index).right.store(static_cast<Index>(top));
+        std::uint64_t pushed = ((top >> 32) + 1) << 32 | index;
+        if (freeList.compare_exchange_weak(top, pushed))
+        {
+            return;
+        }
+    }
+}
+
+template <typename T>
+typename ConcurrentDeque<T>::Slot &ConcurrentDeque<T>::acquireSlot()
+{
+    static thread_local std::size_t start = std::hash<std::thread::id>()(std::this_thread::get_id()) % kSlots;
+    for (std::size_t i = start;; i = (i + 1) % kSlots)
+    {
+        Slot &slot = slots[i];
+        if (!slot.inUse.load(std::memory_order_relaxed) && !slot.inUse.exchange(true, std::memory_order_acquire))
+        {
+            return slot;
+        }
+    }
+}
+
+template <typename T>
+void ConcurrentDeque<T>::releaseSlot(Slot &slot)
+{
+    slot.hazards[0].store(kNull);
+    slot.hazards[1].store(kNull);
+    slot.inUse.store(false, std::memory_order_release);
+}
+
+template <typename T>
+void ConcurrentDeque<T>::retire(Slot &slot, Index index)
+{
+    slot.retired.push_back(index);
+    if (slot.retired.size() >= kRetireThreshold)
+    {
+        scan(slot);
+    }
+}
+
+template <typename T>
+void ConcurrentDeque<T>::scan(Slot &slot)
+{
+    std::vector<Index> protectedNodes;
+    protectedNodes.reserve(2 * kSlots);
+    for (Slot &other : slots)
+    {
+        for (std::atomic<Index> &hazard : other.hazards)
+        {
+            Index index = hazard.load();
+            if (index != kNull)
+            {
+                protectedNodes.push_back(index);
+            }
+        }
+    }
+    std::sort(protectedNodes.begin(), protectedNodes.end());
+
+    std::vector<Index> stillProtected;
+    for (Index index : slot.retired)
+    {
+        if (std::binary_search(protectedNodes.begin(), protectedNodes.end(), index))
+        {
+            stillProtected.push_back(index);
+        }
+        else
+        {
+            freeNode(index);
+        }
+    }
+    slot.retired.swap(stillProtected);
+}
+
+template <typename T>
+void ConcurrentDeque<T>::stabilize(Slot &slot, std::uint64_t word)
+{
+    if (unpack(word).status == kRightPush)
+    {
+        stabilizeRight(slot, word);
+    }
+    else
+    {
+        stabilizeLeft(slot, word);
+    }
+}
+
+template <typename T>
+void ConcurrentDeque<T>::stabilizeRight(Slot &slot, std::uint64_t word)
+{
+    Anchor ends = unpack(word);
+    slot.hazards[0].store(ends.right);
+    if (anchor.load() != word)
+    {
+        return;
+    }
+    Index previous = node(ends.right).left.load();
+    slot.hazards[1].store(previous);
+    if (anchor.load() != word)
+    {
+        return;
+    }
+    Index previousNext = node(previous).right.load();
+    if (previousNext != ends.right)
+    {
+        if (anchor.load() != word)
+        {
+            return;
+        }
+        if (!node(previous).right.compare_exchange_strong(previousNext, ends.right))
+        {
+            return;
+        }
+    }
+    anchor.compare_exchange_strong(word, pack(ends.left, ends.right, kStable));
+}
+
+template <typename T>
+void ConcurrentDeque<T>::stabilizeLeft(Slot &slot, std::uint64_t word)
+{
+    Anchor ends = unpack(word);
+    slot.hazards[0].store(ends.left);
+    if (anchor.load() != word)
+    {
+        return;
+    }
+    Index next = node(ends.left).right.load();
+    slot.hazards[1].store(next);
+    if (anchor.load() != word)
+    {
+        return;
+    }
+    Index nextPrevious = node(next).left.load();
+    if (nextPrevious != ends.left)
+    {
+        if (anchor.load() != word)
+        {
+            return;
+        }
+        if (!node(next).left.compare_exchange_strong(nextPrevious, ends.left))
+        {
+            return;
+        }
+    }
+    anchor.compare_exchange_strong(word, pack(ends.left, ends.right, kStable));
+}
+
+#endif
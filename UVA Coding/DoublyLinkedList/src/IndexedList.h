@@ -0,0 +1,521 @@
+#ifndef INDEXEDLIST_H
+#define INDEXEDLIST_H
+
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <unordered_map>
+#include <utility>
+
+#include "List.h"
+
+/**
+ * @class IndexedList
+ * @brief A List with a hash index from values to the ListNodes that hold them.
+ *
+ * Every insert, remove, makeEmpty, copy and move keeps the index in sync, so `find`, `remove` and
+ * `contains` cost one hash lookup on average instead of a walk from the head. Duplicates are
+ * supported: each value maps to a chain of its occurrences in the order they were inserted, and
+ * `find`/`remove` act on the oldest occurrence still in the list. (Plain List acts on the occurrence
+ * nearest the head; the two agree unless duplicates are inserted out of list order.) Every element also
+ * has an index entry filed under its address, holding its links in that chain, so `erase` unlinks it
+ * in O(1) on average however many duplicates it has.
+ * Values must not be modified through the returned ListItr objects, since that would leave them
+ * filed under their old hash.
+ */
+template <typename T, typename Hash = std::hash<T>, typename KeyEqual = std::equal_to<T>>
+class IndexedList
+{
+public:
+    using iterator = typename List<T>::const_iterator;
+    using const_iterator = typename List<T>::const_iterator;
+
+    /**
+     * @brief Default constructor.
+     *
+     * Creates an empty list with an empty index.
+     */
+    IndexedList();
+
+    /**
+     * @brief Constructor that allocates nodes from a pool.
+     *
+     * @param nodePool The pool to allocate nodes from; it must outlive this list.
+     */
+    explicit IndexedList(ListNodePool<T> &nodePool);
+
+    /**
+     * @brief Copy constructor.
+     *
+     * Copies the list and rebuilds the index over the new nodes.
+     * @param source The source IndexedList to be copied.
+     */
+    IndexedList(const IndexedList &source);
+
+    /**
+     * @brief Move constructor.
+     *
+     * Takes over the nodes and the index of `source`, leaving it a working empty list.
+     * @param source The source IndexedList to be moved from.
+     */
+    IndexedList(IndexedList &&source);
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * @param source The right-hand-side IndexedList to be copied.
+     * @return Reference to the current list.
+     */
+    IndexedList &operator=(const IndexedList &source);
+
+    /**
+     * @brief Move assignment operator.
+     *
+     * @param source The right-hand-side IndexedList to be moved from.
+     * @return Reference to the current list.
+     */
+    IndexedList &operator=(IndexedList &&source);
+
+    /**
+     * @brief Checks if the list is empty.
+     *
+     * @return True if the list is empty, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Removes all elements and clears the index.
+     */
+    void makeEmpty();
+
+    /**
+     * @brief Returns an iterator that points to the first element.
+     *
+     * @return ListItr object pointing to the first ListNode after the dummy head node.
+     */
+    ListItr<T> first();
+
+    /**
+     * @brief Returns an iterator that points to the last element.
+     *
+     * @return ListItr object pointing to the last ListNode before the dummy tail node.
+     */
+    ListItr<T> last();
+
+    /**
+     * @brief Inserts a value after the current iterator position.
+     *
+     * @param x The value to be inserted.
+     * @param position The ListItr object representing the current iterator position.
+     */
+    void insertAfter(const T &x, ListItr<T> position);
+
+    /**
+     * @brief Inserts a value before the current iterator position.
+     *
+     * @param x The value to be inserted.
+     * @param position The ListItr object representing the current iterator position.
+     */
+    void insertBefore(const T &x, ListItr<T> position);
+
+    /**
+     * @brief Inserts a value at the tail of the list.
+     *
+     * @param x The value to be inserted.
+     */
+    void insertAtTail(const T &x);
+
+    /**
+     * @brief Inserts a value at the front of the list.
+     *
+     * @param x The value to be inserted.
+     */
+    void insertAtFront(const T &x);
+
+    /**
+     * @brief Returns an iterator that points to the oldest occurrence of a value, in O(1) on average.
+     *
+     * @param x The value to search for.
+     * @return ListItr object pointing to the value, or the dummy tail node if not found.
+     */
+    ListItr<T> find(const T &x);
+
+    /**
+     * @brief Checks whether a value is in the list, in O(1) on average.
+     *
+     * @param x The value to search for.
+     * @return True if at least one element equals `x`.
+     */
+    bool contains(const T &x) const;
+
+    /**
+     * @brief Returns how many elements equal a value, in O(1) on average.
+     *
+     * @param x The value to search for.
+     * @return The number of occurrences of `x`.
+     */
+    int occurrences(const T &x) const;
+
+    /**
+     * @brief Removes the oldest occurrence of a value from the list, in O(1) on average.
+     *
+     * @param x The value to be removed.
+     */
+    void remove(const T &x);
+
+    /**
+     * @brief Removes the element at the current iterator position, in O(1) on average.
+     *
+     * @param position The ListItr object pointing to the element to be removed.
+     * @return ListItr object pointing to the element that followed the removed one.
+     */
+    ListItr<T> erase(ListItr<T> position);
+
+    /**
+     * @brief Returns the number of elements in the list.
+     *
+     * @return The number of elements in the list.
+     */
+    int size() const;
+
+    /**
+     * @brief Prints the contents of the list forwards (head -> tail) or backwards (tail -> head).
+     *
+     * @param os The output stream to which the list is printed.
+     * @param forward True to print forwards, false to print backwards.
+     */
+    void print(std::ostream &os = std::cout, bool forward = true);
+
+    /**
+     * @brief Returns a read-only iterator to the first element.
+     *
+     * @return Iterator pointing to the first element.
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief Returns a read-only iterator past the last element.
+     *
+     * @return Iterator pointing to the dummy tail node.
+     */
+    const_iterator end() const;
+
+private:
+    /**
+     * @brief The index entry of one element: its position and its neighbours among the occurrences of its value.
+     */
+    struct Link
+    {
+        ListItr<T> position; // The element
+        Link *older;         // The previous occurrence of the same value, or nullptr for the oldest
+        Link *newer;         // The next occurrence of the same value, or nullptr for the newest
+    };
+
+    /**
+     * @brief The occurrences of one value, chained from the oldest to the newest.
+     */
+    struct Chain
+    {
+        Link *oldest = nullptr; // Occurrence find() and remove() act on
+        Link *newest = nullptr; // Occurrence the next insert is chained after
+        int count = 0;          // Number of occurrences
+    };
+
+    using Index = std::unordered_map<T, Chain, Hash, KeyEqual>;
+    using Links = std::unordered_map<const T *, Link>;
+
+    /**
+     * @brief Files a freshly inserted node under its value, undoing the insert if that fails.
+     *
+     * @param position The ListItr object pointing to the new element.
+     */
+    void addToIndex(ListItr<T> position);
+
+    /**
+     * @brief Files a node under its value as the newest occurrence, leaving the index unchanged if that fails.
+     *
+     * @param position The ListItr object pointing to the element.
+     */
+    void indexNode(ListItr<T> position);
+
+    /**
+     * @brief Takes an element out of the index; the node itself is left in the list.
+     *
+     * @param entry The index entry of the element's value.
+     * @param link The element's own entry, which is released.
+     */
+    void unindexNode(typename Index::iterator entry, Link *link);
+
+    /**
+     * @brief Rebuilds the index from the nodes of the list.
+     */
+    void rebuildIndex();
+
+    List<T> list; // The elements, in list order
+    Index index;  // Value -> chain of the elements holding it, oldest first
+    Links links;  // Address of each element -> its entry in its value's chain
+};
+
+template <typename T, typename Hash, typename KeyEqual>
+IndexedList<T, Hash, KeyEqual>::IndexedList()
+{
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+IndexedList<T, Hash, KeyEqual>::IndexedList(ListNodePool<T> &nodePool) : list(nodePool)
+{
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+IndexedList<T, Hash, KeyEqual>::IndexedList(const IndexedList &source) : list(source.list)
+{
+    rebuildIndex();
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+IndexedList<T, Hash, KeyEqual>::IndexedList(IndexedList &&source)
+    : list(std::move(source.list)), index(std::move(source.index)), links(std::move(source.links))
+{
+    source.index.clear();
+    source.links.clear();
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+IndexedList<T, Hash, KeyEqual> &IndexedList<T, Hash, KeyEqual>::operator=(const IndexedList &source)
+{
+    if (this != &source)
+    {
+        list = source.list;
+        rebuildIndex();
+    }
+    return *this;
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+IndexedList<T, Hash, KeyEqual> &IndexedList<T, Hash, KeyEqual>::operator=(IndexedList &&source)
+{
+    if (this != &source)
+    {
+        list = std::move(source.list);
+        index = std::move(source.index);
+        links = std::move(source.links);
+        source.index.clear();
+        source.links.clear();
+    }
+    return *this;
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+bool IndexedList<T, Hash, KeyEqual>::isEmpty() const
+{
+    return list.isEmpty();
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+void IndexedList<T, Hash, KeyEqual>::makeEmpty()
+{
+    index.clear();
+    links.clear();
+    list.makeEmpty();
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+ListItr<T> IndexedList<T, Hash, KeyEqual>::first()
+{
+    return list.first();
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+ListItr<T> IndexedList<T, Hash, KeyEqual>::last()
+{
+    return list.last();
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+void IndexedList<T, Hash, KeyEqual>::insertAfter(const T &x, ListItr<T> position)
+{
+    addToIndex(list.emplaceAfter(position, x));
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+void IndexedList<T, Hash, KeyEqual>::insertBefore(const T &x, ListItr<T> position)
+{
+    addToIndex(list.emplaceBefore(position, x));
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+void IndexedList<T, Hash, KeyEqual>::insertAtTail(const T &x)
+{
+    addToIndex(list.emplaceBack(x));
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+void IndexedList<T, Hash, KeyEqual>::insertAtFront(const T &x)
+{
+    addToIndex(list.emplaceFront(x));
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+ListItr<T> IndexedList<T, Hash, KeyEqual>::find(const T &x)
+{
+    typename Index::iterator entry = index.find(x);
+    if (entry == index.end())
+    {
+        ListItr<T> pastEnd = list.last();
+        pastEnd.moveForward();
+        return pastEnd;
+    }
+    return entry->second.oldest->position;
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+bool IndexedList<T, Hash, KeyEqual>::contains(const T &x) const
+{
+    return index.find(x) != index.end();
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+int IndexedList<T, Hash, KeyEqual>::occurrences(const T &x) const
+{
+    typename Index::const_iterator entry = index.find(x);
+    return entry == index.end() ? 0 : entry->second.count;
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+void IndexedList<T, Hash, KeyEqual>::remove(const T &x)
+{
+    typename Index::iterator entry = index.find(x);
+    if (entry == index.end())
+    {
+        return;
+    }
+
+    Link *oldest = entry->second.oldest;
+    ListItr<T> position = oldest->position;
+    unindexNode(entry, oldest);
+    list.erase(position);
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+ListItr<T> IndexedList<T, Hash, KeyEqual>::erase(ListItr<T> position)
+{
+    if (position.isPastEnd() || position.isPastBeginning())
+    {
+        throw std::invalid_argument("Cannot erase a dummy head or tail node.");
+    }
+
+    const T &value = position.retrieve();
+    unindexNode(index.find(value), &links.find(&value)->second);
+    return list.erase(position);
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+int IndexedList<T, Hash, KeyEqual>::size() const
+{
+    return list.size();
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+void IndexedList<T, Hash, KeyEqual>::print(std::ostream &os, bool forward)
+{
+    list.print(os, forward);
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+typename IndexedList<T, Hash, KeyEqual>::const_iterator IndexedList<T, Hash, KeyEqual>::begin() const
+{
+    return list.begin();
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+typename IndexedList<T, Hash, KeyEqual>::const_iterator IndexedList<T, Hash, KeyEqual>::end() const
+{
+    return list.end();
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+void IndexedList<T, Hash, KeyEqual>::addToIndex(ListItr<T> position)
+{
+    try
+    {
+        indexNode(position);
+    }
+    catch (...)
+    {
+        list.erase(position);
+        throw;
+    }
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+void IndexedList<T, Hash, KeyEqual>::indexNode(ListItr<T> position)
+{
+    const T &value = position.retrieve();
+    typename Links::iterator slot = links.emplace(&value, Link{position, nullptr, nullptr}).first;
+    Chain *chain;
+    try
+    {
+        chain = &index[value];
+    }
+    catch (...)
+    {
+        links.erase(slot);
+        throw;
+    }
+
+    // Elements of an unordered_map never move, so the chain can hold pointers to them
+    Link *link = &slot->second;
+    link->older = chain->newest;
+    if (chain->newest != nullptr)
+    {
+        chain->newest->newer = link;
+    }
+    else
+    {
+        chain->oldest = link;
+    }
+    chain->newest = link;
+    chain->count++;
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+void IndexedList<T, Hash, KeyEqual>::unindexNode(typename Index::iterator entry, Link *link)
+{
+    Chain &chain = entry->second;
+    if (link->older != nullptr)
+    {
+        link->older->newer = link->newer;
+    }
+    else
+    {
+        chain.oldest = link->newer;
+    }
+    if (link->newer != nullptr)
+    {
+        link->newer->older = link->older;
+    }
+    else
+    {
+        chain.newest = link->older;
+    }
+    if (--chain.count == 0)
+    {
+        index.erase(entry);
+    }
+    links.erase(&link->position.retrieve());
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+void IndexedList<T, Hash, KeyEqual>::rebuildIndex()
+{
+    index.clear();
+    links.clear();
+    index.reserve(list.size());
+    links.reserve(list.size());
+    for (ListItr<T> position = list.first(); !position.isPastEnd(); position.moveForward())
+    {
+        indexNode(position);
+    }
+}
+
+#endif
@@ -1,11 +1,37 @@
 #ifndef LIST_H
 #define LIST_H
 
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <initializer_list>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <locale>
+#include <memory>
+#include <memory_resource>
+#include <sstream>
 #include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
 
 #include "ListNode.h"
 #include "ListItr.h"
+#include "ListIterator.h"
+#include "ListStats.h"
+#include "NodePool.h"
+#include "Prefetch.h"
 
 template <typename T>
 class ListNode;
@@ -15,47 +41,173 @@ class ListItr;
 
 using namespace std;
 
+/**
+ * @brief Slab allocator for the nodes of a List<T>. See NodePool.
+ */
+template <typename T>
+using ListNodePool = NodePool<ListNode<T>>;
+
 /**
  * @class List
  * @brief Doubly linked list class.
  *
  * The List class represents a doubly linked list with a dummy head and tail.
  * It provides various operations for manipulating and accessing the elements in the list.
+ *
+ * The dummy head and tail and every node not taken from a ListNodePool are allocated through `Allocator`,
+ * rebound to ListNode<T> with std::allocator_traits. The allocator follows the propagation traits of
+ * std::allocator_traits on copy assignment, move assignment and swap, and nodes are only relinked between
+ * lists whose allocators compare equal.
+ *
+ * `Stats` is a statistics policy (see ListStats.h) that List calls on every allocation, insert, find, remove
+ * and copy. The default NoListStats records nothing and, being an empty base, takes no space;
+ * CountingListStats counts and is read with statistics().
  */
-template <typename T>
-class List
+template <typename T, typename Allocator = std::allocator<T>, typename Stats = NoListStats>
+class List : private Stats
 {
 public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = ListIterator<T, false>;
+    using const_iterator = ListIterator<T, true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
     /**
      * @brief Default constructor.
      *
      * Initializes the List object by setting up the basic list structure with the dummy head and tail nodes.
      */
-    List<T>();
+    List();
+
+    /**
+     * @brief Constructor for an empty list that allocates its nodes through `alloc`.
+     *
+     * @param alloc The allocator to use.
+     */
+    explicit List(const Allocator &alloc);
+
+    /**
+     * @brief Constructor that allocates nodes from a pool.
+     *
+     * Every node of this list (but not the dummy head and tail) is taken from and returned to `nodePool`
+     * instead of going through the allocator. The pool may be shared with other lists and must outlive this list.
+     * @param nodePool The pool to allocate nodes from.
+     * @param alloc The allocator for the dummy head and tail.
+     */
+    explicit List(ListNodePool<T> &nodePool, const Allocator &alloc = Allocator());
 
     /**
      * @brief Copy constructor.
      *
      * Creates a new list of ListNodes whose contents are the same values as the ListNodes in `source`.
+     * The new list allocates from the same node pool as `source`, if it has one, and its allocator is
+     * select_on_container_copy_construction() of the allocator of `source`.
+     * @param source The source List to be copied.
+     */
+    List(const List &source);
+
+    /**
+     * @brief Copy constructor that allocates the copy through `alloc`.
+     *
      * @param source The source List to be copied.
+     * @param alloc The allocator of the new list.
+     */
+    List(const List &source, const Allocator &alloc);
+
+    /**
+     * @brief Move constructor.
+     *
+     * Takes over the ListNodes, dummy head and tail included (and node pool and allocator), of `source`; no value
+     * is copied and nothing is allocated, so `std::vector<List<T>>` moves its lists when it grows.
+     * `source` is left as a working empty list without dummy nodes; it allocates new ones the first time it is
+     * inserted into or handed out an iterator.
+     * @param source The source List to be moved from.
+     */
+    List(List &&source) noexcept;
+
+    /**
+     * @brief Move constructor that allocates through `alloc`.
+     *
+     * If `alloc` equals the allocator of `source` the nodes are relinked as in the move constructor;
+     * otherwise each value is moved into a new node allocated through `alloc`.
+     * @param source The source List to be moved from.
+     * @param alloc The allocator of the new list.
+     */
+    List(List &&source, const Allocator &alloc);
+
+    /**
+     * @brief Constructor that copies the values of the range [first, last).
+     *
+     * The nodes are created and linked in a single pass and the size is set once.
+     * @param first Iterator to the first value.
+     * @param last Iterator past the last value.
+     * @param alloc The allocator to use.
+     */
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    List(InputIt first, InputIt last, const Allocator &alloc = Allocator());
+
+    /**
+     * @brief Constructor that copies the values of an initializer list, in order.
+     *
+     * @param values The values of the new list.
+     * @param alloc The allocator to use.
      */
-    List<T>(const List &source);
+    List(std::initializer_list<T> values, const Allocator &alloc = Allocator());
 
     /**
      * @brief Destructor.
      *
-     * Empties the list and reclaims the memory allocated in the constructor for head and tail.
+     * Empties the list with makeEmpty() and reclaims the memory allocated in the constructor for head and tail.
      */
-    ~List<T>();
+    ~List();
 
     /**
      * @brief Copy assignment operator.
      *
-     * Assigns the contents of `rhs` to the current list.
+     * Assigns the contents of `rhs` to the current list. The current list keeps its own node pool, and its own
+     * allocator unless the allocator propagates on copy assignment.
      * @param rhs The right-hand-side List to be copied.
      * @return Reference to the current list.
      */
-    List<T> &operator=(const List &source);
+    List &operator=(const List &source);
+
+    /**
+     * @brief Move assignment operator.
+     *
+     * Empties the current list, then takes over the ListNodes (and node pool) of `source` by relinking them.
+     * If the allocators do not propagate on move assignment and do not compare equal, the values of `source`
+     * are moved into nodes from this list's allocator instead. `source` is left as a working empty list.
+     * @param source The right-hand-side List to be moved from.
+     * @return Reference to the current list.
+     */
+    List &operator=(List &&source);
+
+    /**
+     * @brief Replaces the contents of the list with the values of the range [first, last).
+     *
+     * The new nodes are built before the old ones are released, so if copying a value throws the list is unchanged.
+     * The exception is the fast path of makeEmpty(): if T is trivially destructible and every live node of the
+     * node pool belongs to this list, the pool is reset first so that the new nodes reuse its blocks, and a
+     * throwing copy leaves the list empty. The range must then not refer to this list's own elements.
+     * With a node pool and a forward range, the new nodes occupy one contiguous run of pool slots.
+     * @param first Iterator to the first value.
+     * @param last Iterator past the last value.
+     */
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void assign(InputIt first, InputIt last);
+
+    /**
+     * @brief Replaces the contents of the list with the values of an initializer list.
+     *
+     * @param values The new values.
+     */
+    void assign(std::initializer_list<T> values);
 
     /**
      * @brief Checks if the list is empty.
@@ -67,7 +219,10 @@ public:
     /**
      * @brief Removes all items except the dummy head and tail nodes.
      *
-     * The list should be a working empty list after this operation.
+     * The list should be a working empty list after this operation. The nodes are detached as one chain and
+     * destroyed in a single forward pass without relinking; pooled storage goes back as one batch. If T is
+     * trivially destructible and every live node of the node pool belongs to this list, the pool is simply
+     * reset, which takes time proportional to its number of blocks rather than to the size of the list.
      */
     void makeEmpty();
 
@@ -85,13 +240,105 @@ public:
      */
     ListItr<T> last();
 
+    /**
+     * @brief Returns a standard iterator to the first element.
+     *
+     * @return Iterator pointing to the first ListNode after the dummy head node.
+     */
+    iterator begin();
+
+    /**
+     * @brief Returns a standard iterator to the first element.
+     *
+     * @return Iterator pointing to the first ListNode after the dummy head node.
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief Returns a standard iterator past the last element.
+     *
+     * @return Iterator pointing to the dummy tail node.
+     */
+    iterator end();
+
+    /**
+     * @brief Returns a standard iterator past the last element.
+     *
+     * @return Iterator pointing to the dummy tail node.
+     */
+    const_iterator end() const;
+
+    /**
+     * @brief Returns a read-only iterator to the first element.
+     *
+     * @return Iterator pointing to the first ListNode after the dummy head node.
+     */
+    const_iterator cbegin() const;
+
+    /**
+     * @brief Returns a read-only iterator past the last element.
+     *
+     * @return Iterator pointing to the dummy tail node.
+     */
+    const_iterator cend() const;
+
+    /**
+     * @brief Returns a reverse iterator to the last element.
+     *
+     * @return Reverse iterator starting at the last ListNode before the dummy tail node.
+     */
+    reverse_iterator rbegin();
+
+    /**
+     * @brief Returns a reverse iterator to the last element.
+     *
+     * @return Reverse iterator starting at the last ListNode before the dummy tail node.
+     */
+    const_reverse_iterator rbegin() const;
+
+    /**
+     * @brief Returns a reverse iterator past the first element.
+     *
+     * @return Reverse iterator that ends at the dummy head node.
+     */
+    reverse_iterator rend();
+
+    /**
+     * @brief Returns a reverse iterator past the first element.
+     *
+     * @return Reverse iterator that ends at the dummy head node.
+     */
+    const_reverse_iterator rend() const;
+
+    /**
+     * @brief Returns a read-only reverse iterator to the last element.
+     *
+     * @return Reverse iterator starting at the last ListNode before the dummy tail node.
+     */
+    const_reverse_iterator crbegin() const;
+
+    /**
+     * @brief Returns a read-only reverse iterator past the first element.
+     *
+     * @return Reverse iterator that ends at the dummy head node.
+     */
+    const_reverse_iterator crend() const;
+
     /**
      * @brief Inserts a value after the current iterator position.
      *
      * @param x The value to be inserted.
      * @param position The ListItr object representing the current iterator position.
      */
-    void insertAfter(T x, ListItr<T> position);
+    void insertAfter(const T &x, ListItr<T> position);
+
+    /**
+     * @brief Inserts a value after the current iterator position, moving it into the new node.
+     *
+     * @param x The value to be inserted.
+     * @param position The ListItr object representing the current iterator position.
+     */
+    void insertAfter(T &&x, ListItr<T> position);
 
     /**
      * @brief Inserts a value before the current iterator position.
@@ -99,21 +346,96 @@ public:
      * @param x The value to be inserted.
      * @param position The ListItr object representing the current iterator position.
      */
-    void insertBefore(T x, ListItr<T> position);
+    void insertBefore(const T &x, ListItr<T> position);
+
+    /**
+     * @brief Inserts a value before the current iterator position, moving it into the new node.
+     *
+     * @param x The value to be inserted.
+     * @param position The ListItr object representing the current iterator position.
+     */
+    void insertBefore(T &&x, ListItr<T> position);
 
     /**
      * @brief Inserts a value at the tail of the list.
      *
      * @param x The value to be inserted.
      */
-    void insertAtTail(T x);
+    void insertAtTail(const T &x);
+
+    /**
+     * @brief Inserts a value at the tail of the list, moving it into the new node.
+     *
+     * @param x The value to be inserted.
+     */
+    void insertAtTail(T &&x);
 
     /**
      * @brief Inserts a value at the front of the list.
      *
      * @param x The value to be inserted.
      */
-    void insertAtFront(T x);
+    void insertAtFront(const T &x);
+
+    /**
+     * @brief Inserts a value at the front of the list, moving it into the new node.
+     *
+     * @param x The value to be inserted.
+     */
+    void insertAtFront(T &&x);
+
+    /**
+     * @brief Constructs a value in place after the current iterator position.
+     *
+     * @param position The ListItr object representing the current iterator position.
+     * @param args The arguments forwarded to the constructor of T.
+     * @return ListItr object pointing to the new element.
+     */
+    template <typename... Args>
+    ListItr<T> emplaceAfter(ListItr<T> position, Args &&...args);
+
+    /**
+     * @brief Constructs a value in place before the current iterator position.
+     *
+     * @param position The ListItr object representing the current iterator position.
+     * @param args The arguments forwarded to the constructor of T.
+     * @return ListItr object pointing to the new element.
+     */
+    template <typename... Args>
+    ListItr<T> emplaceBefore(ListItr<T> position, Args &&...args);
+
+    /**
+     * @brief Constructs a value in place at the tail of the list.
+     *
+     * @param args The arguments forwarded to the constructor of T.
+     * @return ListItr object pointing to the new element.
+     */
+    template <typename... Args>
+    ListItr<T> emplaceBack(Args &&...args);
+
+    /**
+     * @brief Constructs a value in place at the front of the list.
+     *
+     * @param args The arguments forwarded to the constructor of T.
+     * @return ListItr object pointing to the new element.
+     */
+    template <typename... Args>
+    ListItr<T> emplaceFront(Args &&...args);
+
+    /**
+     * @brief Inserts copies of the values of [first, last) before the specified position, in order.
+     *
+     * The new nodes are built as a detached chain, linked in with one splice and counted once.
+     * With a node pool and a forward range, they occupy one contiguous run of pool slots.
+     * If copying a value throws, the list is unchanged.
+     * @param position The position before which the values are inserted; may be past the end.
+     * @param first Iterator to the first value.
+     * @param last Iterator past the last value.
+     * @return Iterator to the first inserted value, or `position` if the range is empty.
+     * @throws std::invalid_argument If `position` is before the beginning of the list.
+     */
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    ListItr<T> insertRange(ListItr<T> position, InputIt first, InputIt last);
 
     /**
      * @brief Returns an iterator that points to the first occurrence of a value.
@@ -122,218 +444,2189 @@ public:
      * @param x The value to search for.
      * @return ListItr object pointing to the first occurrence of the value, or the dummy tail node if not found.
      */
-    ListItr<T> find(T x);
+    ListItr<T> find(const T &x);
 
     /**
-     * @brief Removes the first occurrence of a value from the list.
+     * @brief Returns an iterator to the first element for which `pred` returns true, or the dummy tail node.
      *
-     * @param x The value to be removed.
+     * Like every traversal kernel below, it prefetches the next node while the current one is examined.
+     * @param pred Unary predicate taking a const T&.
+     * @return ListItr object pointing to the first match, or the dummy tail node if there is none.
      */
-    void remove(T x);
+    template <typename Predicate>
+    ListItr<T> findIf(Predicate pred);
 
     /**
-     * @brief Returns the number of elements in the list.
+     * @brief Counts the elements equal to a value.
      *
-     * @return The number of elements in the list.
+     * @param x The value to count.
+     * @return The number of elements equal to `x`.
      */
-    int size() const;
+    int occurrences(const T &x) const;
 
     /**
-     * @brief Prints the contents of the list forwards (head -> tail) or backwards (tail -> head).
-     * This function uses the ListItr class to iterate through the list and prints the values in the specified order.
-     * @param os The output stream to which the list is printed.
-     * @param forward True to print forwards (head -> tail), false to print backwards (tail -> head).
+     * @brief Counts the elements for which `pred` returns true.
+     *
+     * @param pred Unary predicate taking a const T&.
+     * @return The number of matching elements.
      */
-    void print(std::ostream &os = std::cout, bool forward = true);
+    template <typename Predicate>
+    int countIf(Predicate pred) const;
 
-private:
-    ListNode<T> *head; // Dummy node representing the beginning of the list
-    ListNode<T> *tail; // Dummy node representing the end of the list
-    int count;         // Number of elements in the list
-};
+    /**
+     * @brief Calls `f` on every element, from first to last.
+     *
+     * @param f Function object taking a T&; it may modify the element but not the list.
+     * @return `f`, after the last call.
+     */
+    template <typename Function>
+    Function forEach(Function f);
 
-template <typename T>
-List<T>::List()
-{
-    head = new ListNode<T>();
-    tail = new ListNode<T>();
-    head->next = tail;
-    tail->previous = head;
-    count = 0;
-}
+    /**
+     * @brief Folds the elements from first to last with `op`, like std::accumulate.
+     *
+     * @param init The initial value.
+     * @param op Binary operation taking the running value and a const T&.
+     * @return The folded value.
+     */
+    template <typename U, typename BinaryOperation = std::plus<>>
+    U accumulate(U init, BinaryOperation op = BinaryOperation()) const;
 
-template <typename T>
-List<T>::List(const List<T> &source)
-{
-    head = new ListNode<T>();
-    tail = new ListNode<T>();
-    head->next = tail;
-    tail->previous = head;
+    /**
+     * @brief Removes the first occurrence of a value from the list.
+     *
+     * @param x The value to be removed.
+     */
+    void remove(const T &x);
 
-    ListItr<T> iter(source.head->next);
-    while (!iter.isPastEnd())
-    {
-        insertAtTail(iter.retrieve());
-        iter.moveForward();
-    }
-    count = source.count;
-}
+    /**
+     * @brief Removes every element for which `pred` returns true, in a single traversal.
+     *
+     * Matching nodes are unlinked during the walk and destroyed after it, so `pred` always sees intact values;
+     * with a node pool their storage goes back to the pool as one batch.
+     * If `pred` throws, the elements already matched stay removed and the rest of the list is unchanged.
+     * @param pred Unary predicate taking a const T&.
+     * @return The number of elements removed.
+     */
+    template <typename Predicate>
+    int removeIf(Predicate pred);
 
-template <typename T>
-List<T>::~List()
-{
-    makeEmpty();
-    delete tail;
-    delete head;
-}
+    /**
+     * @brief Removes every occurrence of a value, in a single traversal.
+     *
+     * `x` may refer to an element of this list.
+     * @param x The value to be removed.
+     * @return The number of elements removed.
+     */
+    int removeAll(const T &x);
 
-template <typename T>
-List<T> &List<T>::operator=(const List<T> &source)
-{
-    if (this != &source)
-    {
-        makeEmpty();
-        ListItr<T> position(source.head->next);
-        while (!position.isPastEnd())
-        {
-            insertAtTail(position.retrieve());
-            position.moveForward();
-        }
-        count = source.count;
-    }
-    return *this;
-}
+    /**
+     * @brief Removes every element that is equal to the element before it, keeping the first of each run.
+     *
+     * @return The number of elements removed.
+     */
+    int unique();
 
-template <typename T>
-bool List<T>::isEmpty() const
-{
-    return head->next == tail;
-}
+    /**
+     * @brief Removes every element for which `same(kept, element)` is true, where `kept` is the closest
+     * preceding element that was kept.
+     *
+     * @param same Binary predicate taking two const T&.
+     * @return The number of elements removed.
+     */
+    template <typename BinaryPredicate>
+    int unique(BinaryPredicate same);
 
-template <typename T>
-void List<T>::makeEmpty()
-{
-    while (!isEmpty())
-    {
+    /**
+     * @brief Removes the element at the current iterator position.
+     *
+     * @param position The ListItr object pointing to the element to be removed.
+     * @return ListItr object pointing to the element that followed the removed one.
+     */
+    ListItr<T> erase(ListItr<T> position);
 
-        ListItr<T> iter = first();
+    /**
+     * @brief Moves the element at the current iterator position to the front of the list.
+     *
+     * Only pointers are updated: the node is relinked, not copied or reallocated, so `position` stays valid.
+     * @param position The ListItr object pointing to the element to be moved.
+     */
+    void moveToFront(ListItr<T> position);
 
-        (iter.current->previous)->next = iter.current->next;
+    /**
+     * @brief Moves every element of `source` in front of the current iterator position, in O(1).
+     *
+     * Nodes are relinked, not copied or reallocated, so ListItr objects into `source` stay valid and now point into this list.
+     * Both lists must allocate nodes the same way (the same node pool, or both new/delete).
+     * @param position The ListItr object in front of which the elements are placed; may point to the dummy tail node.
+     * @param source The list whose elements are moved; it is left empty.
+     */
+    void splice(ListItr<T> position, List &source);
 
-        (iter.current->next)->previous = iter.current->previous;
+    /**
+     * @brief Moves one element of `source` in front of the current iterator position, in O(1).
+     *
+     * `source` may be this list.
+     * @param position The ListItr object in front of which the element is placed; may point to the dummy tail node.
+     * @param source The list that holds the element.
+     * @param element The ListItr object pointing to the element to be moved.
+     */
+    void splice(ListItr<T> position, List &source, ListItr<T> element);
 
-        delete iter.current;
-    }
+    /**
+     * @brief Moves the elements [firstElement, pastLast) of `source` in front of the current iterator position.
+     *
+     * Relinking is O(1); when `source` is another list the moved elements are also counted, which walks
+     * the range (but never the rest of either list). `position` must not lie inside the range.
+     * @param position The ListItr object in front of which the elements are placed; may point to the dummy tail node.
+     * @param source The list that holds the elements.
+     * @param firstElement The ListItr object pointing to the first element to be moved.
+     * @param pastLast The ListItr object pointing to the element after the last one to be moved.
+     */
+    void splice(ListItr<T> position, List &source, ListItr<T> firstElement, ListItr<T> pastLast);
 
-    count = 0;
-}
+    /**
+     * @brief Splits the list in two at the current iterator position.
+     *
+     * The elements from `position` to the end are relinked into the returned list, which shares this list's node pool.
+     * Counting the moved elements walks from `position` towards both ends at once, so it costs
+     * O(min(k, n - k)) for a split k elements from either end.
+     * @param position The ListItr object pointing to the first element of the second half; may point to the dummy tail node.
+     * @return The list holding the elements from `position` to the end.
+     */
+    List splitAt(ListItr<T> position);
 
-template <typename T>
-ListItr<T> List<T>::first()
-{
-    return ListItr<T>(head->next);
-}
+    /**
+     * @brief Merges a sorted list into this sorted list, in ascending order of `operator<`.
+     *
+     * See merge(List &, Compare).
+     * @param source The sorted list whose elements are moved; it is left empty.
+     */
+    void merge(List &source);
 
-template <typename T>
-ListItr<T> List<T>::last()
-{
-    return ListItr<T>(tail->previous);
-}
+    /**
+     * @brief Merges a sorted list into this sorted list by relinking nodes, in O(n + m) without allocating.
+     *
+     * The merge is stable: elements of this list come before equal elements of `source`.
+     * Both lists must allocate nodes the same way (the same node pool, or both new/delete).
+     * @param source The list whose elements are moved, sorted by `comp`; it is left empty.
+     * @param comp Strict weak ordering; `comp(a, b)` is true if `a` goes before `b`.
+     */
+    template <typename Compare>
+    void merge(List &source, Compare comp);
 
-template <typename T>
-void List<T>::insertAfter(T x, ListItr<T> position)
-{
-    if (position.isPastEnd())
-    {
-        throw std::invalid_argument("Cannot insert after the end of the list.");
-    }
+    /**
+     * @brief Sorts the list in ascending order of `operator<`.
+     *
+     * See sort(Compare).
+     */
+    void sort();
 
-    ListNode<T> *newNode = new ListNode<T>(x);
+    /**
+     * @brief Sorts the list in place by relinking its nodes.
+     *
+     * Bottom-up natural merge sort: stable, O(n log n) comparisons (O(n) for sorted input), no allocation,
+     * and no value is copied or moved, so ListItr objects keep pointing to the same elements.
+     * If `comp` throws, every element is still in the list, in an unspecified order.
+     * @param comp Strict weak ordering; `comp(a, b)` is true if `a` goes before `b`.
+     */
+    template <typename Compare>
+    void sort(Compare comp);
+
+    /**
+     * @brief Returns the number of elements in the list.
+     *
+     * @return The number of elements in the list.
+     */
+    int size() const;
+
+    /**
+     * @brief Prints the contents of the list forwards (head -> tail) or backwards (tail -> head).
+     * Each value is followed by a space and the output ends with std::endl. Goes through exportRange(),
+     * so arithmetic values are written in large chunks when the stream has its default formatting.
+     * @param os The output stream to which the list is printed.
+     * @param forward True to print forwards (head -> tail), false to print backwards (tail -> head).
+     */
+    void print(std::ostream &os = std::cout, bool forward = true);
+
+    /**
+     * @brief Writes the values of [first, last) to a stream, each followed by `delimiter`. Nothing is flushed.
+     *
+     * Pass begin()/end() for the whole list, rbegin()/rend() to write it backwards, or any sub-range.
+     * If T is an arithmetic type (other than a character type) and the stream has its default flags,
+     * precision and width and the classic locale, values are formatted with std::to_chars into a 64 KiB
+     * buffer that is written in large chunks; the bytes are the same as `os << value << delimiter`.
+     * Otherwise each value goes through operator<<.
+     * @param os The output stream.
+     * @param first Iterator to the first value to write.
+     * @param last Iterator past the last value to write.
+     * @param delimiter Written after every value.
+     */
+    template <typename Iterator>
+    void exportRange(std::ostream &os, Iterator first, Iterator last, const std::string &delimiter = " ") const;
+
+    /**
+     * @brief Writes the values of [first, last) to a file descriptor, each followed by `delimiter`.
+     *
+     * Values are formatted as by a stream in its default state and handed to write(2) in 64 KiB chunks.
+     * @param fd The file descriptor, for example of a log file or a pipe.
+     * @param first Iterator to the first value to write.
+     * @param last Iterator past the last value to write.
+     * @param delimiter Written after every value.
+     * @throws std::system_error If write(2) fails.
+     */
+    template <typename Iterator>
+    void exportRange(int fd, Iterator first, Iterator last, const std::string &delimiter = " ") const;
+
+    /**
+     * @brief Writes the list to a binary stream.
+     *
+     * The data starts with a 24-byte header (magic "DLLS", format version, type tag, element size,
+     * byte-order mark and element count) followed by the values in list order. Trivially copyable values
+     * are written as raw bytes and std::string values as a 64-bit length and the characters; values are
+     * gathered into 64 KiB chunks so the stream sees few, large writes. Snapshots use the native byte
+     * order and layout and are meant to be read back on the same platform.
+     * @param os The binary output stream.
+     * @throws std::runtime_error If the stream fails.
+     */
+    void save(std::ostream &os) const;
+
+    /**
+     * @brief Writes the list to a file, replacing it. See save(std::ostream&).
+     *
+     * @param path The file to write.
+     * @throws std::runtime_error If the file cannot be opened or written.
+     */
+    void save(const std::string &path) const;
+
+    /**
+     * @brief Replaces the contents of the list with a snapshot written by save().
+     *
+     * The counts in the data are not trusted: memory grows only as values are actually read. With a node
+     * pool and a stream that can seek, one contiguous run of slots for the stored element count is reserved
+     * up front, once the stream is known to hold enough bytes for it.
+     * The new nodes are built before the old ones are released, so on any error the list is unchanged.
+     * @param is The binary input stream.
+     * @throws std::runtime_error If the data is truncated, was written for another element type, or uses
+     * an unknown format version.
+     */
+    void load(std::istream &is);
+
+    /**
+     * @brief Replaces the contents of the list with a snapshot file written by save().
+     *
+     * @param path The file to read.
+     * @throws std::runtime_error If the file cannot be opened or does not hold a snapshot of this element type.
+     */
+    void load(const std::string &path);
+
+    /**
+     * @brief Returns the node pool this list allocates from.
+     *
+     * @return Pointer to the pool, or nullptr if nodes are allocated with new/delete.
+     */
+    ListNodePool<T> *nodePool() const;
+
+    /**
+     * @brief Returns a copy of the allocator of the list.
+     *
+     * @return The allocator, rebound to T.
+     */
+    allocator_type get_allocator() const;
+
+    /**
+     * @brief Exchanges the contents, node pools and (if they propagate on swap) allocators of two lists.
+     *
+     * No node is copied or moved, so iterators stay valid and refer to the other list afterwards.
+     * @param other The list to swap with.
+     * @throws std::invalid_argument If the allocators do not propagate on swap and do not compare equal.
+     */
+    void swap(List &other);
+
+    /**
+     * @brief Returns the counters of the statistics policy, with the bytes the list holds now.
+     *
+     * Each list counts its own operations; copies, moves and swaps do not carry counters over, and nodes
+     * relinked from another list (splice, move, load) are freed here but were allocated there.
+     * @return The counters, all zero with NoListStats.
+     */
+    ListStatsSnapshot statistics() const;
+
+private:
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<ListNode<T>>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    /**
+     * @brief Allocates a node through `alloc` and constructs its value from `args`.
+     *
+     * @param alloc The allocator to use.
+     * @param args The arguments forwarded to the constructor of T.
+     * @return Pointer to the new, unlinked node.
+     */
+    template <typename... Args>
+    static ListNode<T> *newNode(NodeAllocator &alloc, Args &&...args);
+
+    /**
+     * @brief Destroys a node allocated by newNode() and returns its memory to `alloc`.
+     *
+     * @param alloc The allocator the node came from.
+     * @param node The unlinked node to destroy.
+     */
+    static void deleteNode(NodeAllocator &alloc, ListNode<T> *node);
+
+    /**
+     * @brief Moves an empty list to a copy of `replacement`, reallocating the dummy head and tail through it.
+     *
+     * If allocating the new dummy nodes throws, the list keeps its old allocator.
+     * @param replacement The allocator to adopt.
+     */
+    void replaceAllocator(const NodeAllocator &replacement);
+
+    /**
+     * @brief Allocates the dummy head and tail through the list's allocator and links them to each other.
+     *
+     * If the allocation throws, head and tail are left unchanged.
+     */
+    void createSentinels();
+
+    /**
+     * @brief Allocates the dummy head and tail if the list was moved from and has none.
+     */
+    void ensureSentinels();
+
+    /**
+     * @brief Returns the first node after the dummy head, or the tail (null) if the list has no dummy nodes.
+     *
+     * @return The node a forward traversal starts at.
+     */
+    ListNode<T> *frontNode() const;
+
+    /**
+     * @brief Allocates a node and constructs its value from `args`, from the pool if there is one.
+     *
+     * @param args The arguments forwarded to the constructor of T.
+     * @return Pointer to the new, unlinked node.
+     */
+    template <typename... Args>
+    ListNode<T> *createNode(Args &&...args);
+
+    /**
+     * @brief Moves every ListNode of `source` to the end of this list without copying values.
+     *
+     * @param source The list whose nodes are taken; it is left empty.
+     */
+    void takeNodes(List &source);
+
+    /**
+     * @brief Creates one node per value of [first, last), linked to each other but not into the list.
+     *
+     * With a node pool and a forward range, the nodes are carved from one contiguous run of pool slots.
+     * If a constructor throws, the nodes created so far are destroyed and the exception propagates.
+     * @param first Iterator to the first value.
+     * @param last Iterator past the last value.
+     * @param lastNode Receives the last node of the chain.
+     * @param built Receives the number of nodes created.
+     * @return The first node of the chain, or nullptr for an empty range.
+     */
+    template <typename InputIt>
+    ListNode<T> *buildChain(InputIt first, InputIt last, ListNode<T> *&lastNode, int &built);
+
+    /**
+     * @brief Links a chain from buildChain() in front of `position` and adds its length to the count.
+     *
+     * @param position The node in front of which the chain is placed.
+     * @param firstNode The first node of the chain, or nullptr for an empty chain.
+     * @param lastNode The last node of the chain.
+     * @param built The number of nodes in the chain.
+     */
+    void linkChainBefore(ListNode<T> *position, ListNode<T> *firstNode, ListNode<T> *lastNode, int built);
+
+    /**
+     * @brief Unlinks the chain of nodes [firstNode, lastNode] and links it in front of `position`.
+     *
+     * Only pointers are updated; the caller adjusts the counts.
+     * @param position The node in front of which the chain is placed.
+     * @param firstNode The first node of the chain.
+     * @param lastNode The last node of the chain.
+     */
+    static void relinkBefore(ListNode<T> *position, ListNode<T> *firstNode, ListNode<T> *lastNode);
+
+    /**
+     * @brief Throws unless nodes of `source` may be relinked into this list.
+     *
+     * @param source The list nodes would be taken from.
+     */
+    void checkSamePool(const List &source) const;
+
+    /**
+     * @brief Merges two sorted null-terminated chains linked through `next` only.
+     *
+     * Nodes of `first` go before equal nodes of `second`. If `comp` throws, `first` holds every node of both chains.
+     * @param first The first chain; receives the merged chain.
+     * @param second The second chain; set to nullptr.
+     * @param comp Strict weak ordering.
+     */
+    template <typename Compare>
+    static void mergeChains(ListNode<T> *&first, ListNode<T> *&second, Compare &comp);
+
+    /**
+     * @brief Links a null-terminated chain between the dummy head and tail, restoring the `previous` pointers.
+     *
+     * @param chain The first node of the chain, or nullptr for an empty list.
+     */
+    void adoptChain(ListNode<T> *chain);
+
+    /**
+     * @brief Calls `visit` on each element node from first to last until it returns true.
+     *
+     * The next node is prefetched before `visit` runs, so its cache miss overlaps with the work on the
+     * current node instead of starting only when the walk reaches it.
+     * @param visit Function object taking a ListNode<T>* and returning true to stop.
+     * @return The node `visit` stopped at, or the dummy tail.
+     */
+    template <typename Visitor>
+    ListNode<T> *scanNodes(Visitor visit) const;
+
+    /**
+     * @brief Destroys a node and releases its memory to wherever createNode() got it from.
+     *
+     * @param node The unlinked node to destroy.
+     */
+    void destroyNode(ListNode<T> *node);
+
+    /**
+     * @brief Destroys every node of a null-terminated chain linked through `next`.
+     *
+     * With a node pool the storage is returned in one batch.
+     * @param chain The first node of the chain, or nullptr.
+     */
+    void destroyChain(ListNode<T> *chain);
+
+    /**
+     * @brief Returns the type tag stored in snapshot headers for T.
+     *
+     * @return 1 for signed integers, 2 for unsigned integers, 3 for floating point, 4 for other trivially
+     * copyable types and 5 for std::string.
+     */
+    static constexpr std::uint16_t snapshotTypeTag();
+
+    /**
+     * @brief Returns how many bytes are left between the read position of a stream and its end.
+     *
+     * The read position is restored before returning.
+     * @param is The stream.
+     * @return The number of bytes, or the largest std::uint64_t if the stream cannot seek.
+     */
+    static std::uint64_t bytesLeftIn(std::istream &is);
+
+    /**
+     * @brief Formats the values of [first, last) into a buffer and hands every full chunk to `write`.
+     *
+     * @param first Iterator to the first value to write.
+     * @param last Iterator past the last value to write.
+     * @param delimiter Written after every value.
+     * @param write Called with (const char *data, std::size_t length) for each chunk.
+     */
+    template <typename Iterator, typename Writer>
+    static void formatChunks(Iterator first, Iterator last, const std::string &delimiter, Writer write);
+
+    /**
+     * @brief Checks whether std::to_chars output matches what `os << value` would produce for T.
+     *
+     * @param os The stream the values are meant for.
+     * @return True for arithmetic, non-character T and a stream in its default formatting state.
+     */
+    static bool formatsLikeToChars(const std::ostream &os);
+
+    // Arithmetic types that operator<< prints as numbers (character types print as characters)
+    static constexpr bool numericText = std::is_arithmetic<T>::value && !std::is_same<T, char>::value &&
+                                        !std::is_same<T, signed char>::value && !std::is_same<T, unsigned char>::value &&
+                                        !std::is_same<T, wchar_t>::value && !std::is_same<T, char16_t>::value &&
+                                        !std::is_same<T, char32_t>::value;
+    static constexpr std::size_t exportChunkBytes = 65536; // Size of the buffer exportRange() writes out at once
+
+    static constexpr std::uint16_t snapshotVersion = 1;       // Format version written by save()
+    static constexpr std::size_t snapshotChunkBytes = 65536; // Bytes gathered before each write or read
+
+    NodeAllocator allocator; // Allocates the dummy nodes and every node not taken from the pool
+    ListNode<T> *head;       // Dummy node representing the beginning of the list
+    ListNode<T> *tail;       // Dummy node representing the end of the list
+    int count;               // Number of elements in the list
+    ListNodePool<T> *pool;   // Pool the nodes are allocated from, or nullptr for the allocator
+};
+
+template <typename T, typename Allocator, typename Stats>
+List<T, Allocator, Stats>::List() : List(Allocator())
+{
+}
+
+template <typename T, typename Allocator, typename Stats>
+List<T, Allocator, Stats>::List(const Allocator &alloc) : allocator(alloc)
+{
+    createSentinels();
+    count = 0;
+    pool = nullptr;
+}
+
+template <typename T, typename Allocator, typename Stats>
+List<T, Allocator, Stats>::List(ListNodePool<T> &nodePool, const Allocator &alloc) : List(alloc)
+{
+    pool = &nodePool;
+}
+
+template <typename T, typename Allocator, typename Stats>
+List<T, Allocator, Stats>::List(const List<T, Allocator, Stats> &source)
+    : List(source, std::allocator_traits<Allocator>::select_on_container_copy_construction(source.get_allocator()))
+{
+}
+
+template <typename T, typename Allocator, typename Stats>
+List<T, Allocator, Stats>::List(const List<T, Allocator, Stats> &source, const Allocator &alloc) : List(alloc)
+{
+    // The dummy nodes exist once the delegated constructor returns, so the destructor cleans up if a copy throws
+    pool = source.pool;
+    ListNode<T> *lastNode;
+    int built;
+    ListNode<T> *firstNode = buildChain(source.begin(), source.end(), lastNode, built);
+    linkChainBefore(tail, firstNode, lastNode, built);
+    Stats::recordCopy(static_cast<std::uint64_t>(built));
+}
+
+template <typename T, typename Allocator, typename Stats>
+List<T, Allocator, Stats>::List(List<T, Allocator, Stats> &&source) noexcept
+    : allocator(source.allocator), head(source.head), tail(source.tail), count(source.count), pool(source.pool)
+{
+    source.head = nullptr;
+    source.tail = nullptr;
+    source.count = 0;
+}
+
+template <typename T, typename Allocator, typename Stats>
+List<T, Allocator, Stats>::List(List<T, Allocator, Stats> &&source, const Allocator &alloc) : List(alloc)
+{
+    pool = source.pool;
+    if (pool != nullptr || allocator == source.allocator)
+    {
+        takeNodes(source);
+        return;
+    }
+
+    ListNode<T> *lastNode;
+    int built;
+    ListNode<T> *firstNode =
+        buildChain(std::make_move_iterator(source.begin()), std::make_move_iterator(source.end()), lastNode, built);
+    linkChainBefore(tail, firstNode, lastNode, built);
+    source.makeEmpty();
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename InputIt, typename>
+List<T, Allocator, Stats>::List(InputIt first, InputIt last, const Allocator &alloc) : List(alloc)
+{
+    ListNode<T> *lastNode;
+    int built;
+    ListNode<T> *firstNode = buildChain(first, last, lastNode, built);
+    linkChainBefore(tail, firstNode, lastNode, built);
+}
+
+template <typename T, typename Allocator, typename Stats>
+List<T, Allocator, Stats>::List(std::initializer_list<T> values, const Allocator &alloc) : List(values.begin(), values.end(), alloc)
+{
+}
+
+template <typename T, typename Allocator, typename Stats>
+List<T, Allocator, Stats>::~List()
+{
+    if (head == nullptr)
+    {
+        // Moved from: there is nothing left to release
+        return;
+    }
+    makeEmpty();
+    deleteNode(allocator, tail);
+    deleteNode(allocator, head);
+}
+
+template <typename T, typename Allocator, typename Stats>
+List<T, Allocator, Stats> &List<T, Allocator, Stats>::operator=(const List<T, Allocator, Stats> &source)
+{
+    if (this != &source)
+    {
+        if constexpr (NodeTraits::propagate_on_container_copy_assignment::value)
+        {
+            if (allocator != source.allocator)
+            {
+                // The old nodes must go back to the old allocator before it is replaced
+                makeEmpty();
+                replaceAllocator(source.allocator);
+            }
+        }
+        assign(source.begin(), source.end());
+        Stats::recordCopy(static_cast<std::uint64_t>(count));
+    }
+    return *this;
+}
+
+template <typename T, typename Allocator, typename Stats>
+List<T, Allocator, Stats> &List<T, Allocator, Stats>::operator=(List<T, Allocator, Stats> &&source)
+{
+    if (this == &source)
+    {
+        return *this;
+    }
+
+    if constexpr (NodeTraits::propagate_on_container_move_assignment::value)
+    {
+        if (allocator != source.allocator)
+        {
+            makeEmpty();
+            replaceAllocator(source.allocator);
+        }
+    }
+    else if (source.pool == nullptr && allocator != source.allocator)
+    {
+        // This allocator cannot free the nodes of `source`, so the values are moved into nodes of our own
+        makeEmpty();
+        pool = nullptr;
+        assign(std::make_move_iterator(source.begin()), std::make_move_iterator(source.end()));
+        source.makeEmpty();
+        return *this;
+    }
+    makeEmpty();
+    pool = source.pool;
+    takeNodes(source);
+    return *this;
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename InputIt, typename>
+void List<T, Allocator, Stats>::assign(InputIt first, InputIt last)
+{
+    if (std::is_trivially_destructible<T>::value && pool != nullptr &&
+        pool->liveNodes() == static_cast<std::size_t>(count))
+    {
+        // Building first would keep every old node alive next to the new ones and grow the pool
+        makeEmpty();
+    }
+
+    ListNode<T> *lastNode;
+    int built;
+    ListNode<T> *firstNode = buildChain(first, last, lastNode, built);
+    makeEmpty();
+    linkChainBefore(tail, firstNode, lastNode, built);
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::assign(std::initializer_list<T> values)
+{
+    assign(values.begin(), values.end());
+}
+
+template <typename T, typename Allocator, typename Stats>
+bool List<T, Allocator, Stats>::isEmpty() const
+{
+    return head == nullptr || head->next == tail;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::makeEmpty()
+{
+    ensureSentinels();
+    if (isEmpty())
+    {
+        return;
+    }
+
+    ListNode<T> *chain = head->next;
+    tail->previous->next = nullptr;
+    head->next = tail;
+    tail->previous = head;
+    bool ownsEveryPoolNode = pool != nullptr && pool->liveNodes() == static_cast<std::size_t>(count);
+    count = 0;
+
+    if (std::is_trivially_destructible<T>::value && ownsEveryPoolNode)
+    {
+        // No other list has a node in the pool and no node needs its destructor run
+        Stats::recordFree(pool->liveNodes());
+        pool->reset();
+        return;
+    }
+    destroyChain(chain);
+}
+
+template <typename T, typename Allocator, typename Stats>
+ListItr<T> List<T, Allocator, Stats>::first()
+{
+    ensureSentinels();
+    return ListItr<T>(head->next);
+}
+
+template <typename T, typename Allocator, typename Stats>
+ListItr<T> List<T, Allocator, Stats>::last()
+{
+    ensureSentinels();
+    return ListItr<T>(tail->previous);
+}
+
+template <typename T, typename Allocator, typename Stats>
+typename List<T, Allocator, Stats>::iterator List<T, Allocator, Stats>::begin()
+{
+    ensureSentinels();
+    return iterator(head->next);
+}
+
+template <typename T, typename Allocator, typename Stats>
+typename List<T, Allocator, Stats>::const_iterator List<T, Allocator, Stats>::begin() const
+{
+    return const_iterator(frontNode());
+}
+
+template <typename T, typename Allocator, typename Stats>
+typename List<T, Allocator, Stats>::iterator List<T, Allocator, Stats>::end()
+{
+    ensureSentinels();
+    return iterator(tail);
+}
+
+template <typename T, typename Allocator, typename Stats>
+typename List<T, Allocator, Stats>::const_iterator List<T, Allocator, Stats>::end() const
+{
+    return const_iterator(tail);
+}
+
+template <typename T, typename Allocator, typename Stats>
+typename List<T, Allocator, Stats>::const_iterator List<T, Allocator, Stats>::cbegin() const
+{
+    return begin();
+}
+
+template <typename T, typename Allocator, typename Stats>
+typename List<T, Allocator, Stats>::const_iterator List<T, Allocator, Stats>::cend() const
+{
+    return end();
+}
+
+template <typename T, typename Allocator, typename Stats>
+typename List<T, Allocator, Stats>::reverse_iterator List<T, Allocator, Stats>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <typename T, typename Allocator, typename Stats>
+typename List<T, Allocator, Stats>::const_reverse_iterator List<T, Allocator, Stats>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <typename T, typename Allocator, typename Stats>
+typename List<T, Allocator, Stats>::reverse_iterator List<T, Allocator, Stats>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template <typename T, typename Allocator, typename Stats>
+typename List<T, Allocator, Stats>::const_reverse_iterator List<T, Allocator, Stats>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <typename T, typename Allocator, typename Stats>
+typename List<T, Allocator, Stats>::const_reverse_iterator List<T, Allocator, Stats>::crbegin() const
+{
+    return rbegin();
+}
+
+template <typename T, typename Allocator, typename Stats>
+typename List<T, Allocator, Stats>::const_reverse_iterator List<T, Allocator, Stats>::crend() const
+{
+    return rend();
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::insertAfter(const T &x, ListItr<T> position)
+{
+    emplaceAfter(position, x);
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::insertAfter(T &&x, ListItr<T> position)
+{
+    emplaceAfter(position, std::move(x));
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::insertBefore(const T &x, ListItr<T> position)
+{
+    emplaceBefore(position, x);
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::insertBefore(T &&x, ListItr<T> position)
+{
+    emplaceBefore(position, std::move(x));
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::insertAtTail(const T &x)
+{
+    emplaceBack(x);
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::insertAtTail(T &&x)
+{
+    emplaceBack(std::move(x));
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::insertAtFront(const T &x)
+{
+    emplaceFront(x);
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::insertAtFront(T &&x)
+{
+    emplaceFront(std::move(x));
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename... Args>
+ListItr<T> List<T, Allocator, Stats>::emplaceAfter(ListItr<T> position, Args &&...args)
+{
+    if (position.isPastEnd())
+    {
+        throw std::invalid_argument("Cannot insert after the end of the list.");
+    }
+
+    ListNode<T> *newNode = createNode(std::forward<Args>(args)...);
     newNode->previous = position.current;
     newNode->next = position.current->next;
     newNode->next->previous = newNode;
     position.current->next = newNode;
     count++;
+    Stats::recordInsert(position.current == head ? ListInsertion::Front : ListInsertion::After);
+    return ListItr<T>(newNode);
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename... Args>
+ListItr<T> List<T, Allocator, Stats>::emplaceBefore(ListItr<T> position, Args &&...args)
+{
+    if (position.isPastBeginning())
+    {
+        throw std::invalid_argument("Cannot insert before the beginning of the list.");
+    }
+
+    ListNode<T> *newNode = createNode(std::forward<Args>(args)...);
+    newNode->next = position.current;
+    newNode->previous = position.current->previous;
+    newNode->previous->next = newNode;
+    position.current->previous = newNode;
+    count++;
+    Stats::recordInsert(position.current == tail ? ListInsertion::Tail : ListInsertion::Before);
+    return ListItr<T>(newNode);
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename... Args>
+ListItr<T> List<T, Allocator, Stats>::emplaceBack(Args &&...args)
+{
+    ensureSentinels();
+    return emplaceBefore(ListItr<T>(tail), std::forward<Args>(args)...);
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename... Args>
+ListItr<T> List<T, Allocator, Stats>::emplaceFront(Args &&...args)
+{
+    ensureSentinels();
+    return emplaceAfter(ListItr<T>(head), std::forward<Args>(args)...);
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename InputIt, typename>
+ListItr<T> List<T, Allocator, Stats>::insertRange(ListItr<T> position, InputIt first, InputIt last)
+{
+    if (position.isPastBeginning())
+    {
+        throw std::invalid_argument("Cannot insert before the beginning of the list.");
+    }
+
+    ListNode<T> *lastNode;
+    int built;
+    ListNode<T> *firstNode = buildChain(first, last, lastNode, built);
+    if (firstNode == nullptr)
+    {
+        return position;
+    }
+    linkChainBefore(position.current, firstNode, lastNode, built);
+    return ListItr<T>(firstNode);
+}
+
+template <typename T, typename Allocator, typename Stats>
+ListItr<T> List<T, Allocator, Stats>::find(const T &x)
+{
+    // With NoListStats the hop counter is never read and compiles away
+    ensureSentinels();
+    std::uint64_t hops = 0;
+    ListNode<T> *node = scanNodes([&x, &hops](ListNode<T> *candidate) {
+        hops++;
+        return !(candidate->value != x);
+    });
+    Stats::recordFind(hops);
+    return ListItr<T>(node);
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename Predicate>
+ListItr<T> List<T, Allocator, Stats>::findIf(Predicate pred)
+{
+    ensureSentinels();
+    std::uint64_t hops = 0;
+    ListNode<T> *node = scanNodes([&pred, &hops](ListNode<T> *candidate) {
+        hops++;
+        return static_cast<bool>(pred(static_cast<const T &>(candidate->value)));
+    });
+    Stats::recordFind(hops);
+    return ListItr<T>(node);
+}
+
+template <typename T, typename Allocator, typename Stats>
+int List<T, Allocator, Stats>::occurrences(const T &x) const
+{
+    return countIf([&x](const T &value) { return value == x; });
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename Predicate>
+int List<T, Allocator, Stats>::countIf(Predicate pred) const
+{
+    int matches = 0;
+    scanNodes([&](ListNode<T> *node) {
+        if (pred(static_cast<const T &>(node->value)))
+        {
+            matches++;
+        }
+        return false;
+    });
+    return matches;
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename Function>
+Function List<T, Allocator, Stats>::forEach(Function f)
+{
+    scanNodes([&f](ListNode<T> *node) {
+        f(node->value);
+        return false;
+    });
+    return f;
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename U, typename BinaryOperation>
+U List<T, Allocator, Stats>::accumulate(U init, BinaryOperation op) const
+{
+    scanNodes([&](ListNode<T> *node) {
+        init = op(std::move(init), static_cast<const T &>(node->value));
+        return false;
+    });
+    return init;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::remove(const T &x)
+{
+    ListItr<T> iter = find(x);
+    if (!iter.isPastEnd())
+    {
+        erase(iter);
+    }
+    else
+    {
+        Stats::recordRemoveMiss();
+    }
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename Predicate>
+int List<T, Allocator, Stats>::removeIf(Predicate pred)
+{
+    if (isEmpty())
+    {
+        return 0;
+    }
+
+    ListNode<T> *doomed = nullptr;
+    int removed = 0;
+    try
+    {
+        ListNode<T> *node = head->next;
+        while (node != tail)
+        {
+            ListNode<T> *next = node->next;
+            if (pred(static_cast<const T &>(node->value)))
+            {
+                node->previous->next = next;
+                next->previous = node->previous;
+                node->next = doomed;
+                doomed = node;
+                removed++;
+            }
+            node = next;
+        }
+    }
+    catch (...)
+    {
+        count -= removed;
+        Stats::recordRemove(static_cast<std::uint64_t>(removed));
+        destroyChain(doomed);
+        throw;
+    }
+
+    count -= removed;
+    Stats::recordRemove(static_cast<std::uint64_t>(removed));
+    destroyChain(doomed);
+    return removed;
+}
+
+template <typename T, typename Allocator, typename Stats>
+int List<T, Allocator, Stats>::removeAll(const T &x)
+{
+    return removeIf([&x](const T &value) { return value == x; });
+}
+
+template <typename T, typename Allocator, typename Stats>
+int List<T, Allocator, Stats>::unique()
+{
+    return unique([](const T &kept, const T &value) { return kept == value; });
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename BinaryPredicate>
+int List<T, Allocator, Stats>::unique(BinaryPredicate same)
+{
+    if (isEmpty())
+    {
+        return 0;
+    }
+
+    ListNode<T> *doomed = nullptr;
+    int removed = 0;
+    try
+    {
+        ListNode<T> *kept = head->next;
+        ListNode<T> *node = kept->next;
+        while (node != tail)
+        {
+            ListNode<T> *next = node->next;
+            if (same(static_cast<const T &>(kept->value), static_cast<const T &>(node->value)))
+            {
+                kept->next = next;
+                next->previous = kept;
+                node->next = doomed;
+                doomed = node;
+                removed++;
+            }
+            else
+            {
+                kept = node;
+            }
+            node = next;
+        }
+    }
+    catch (...)
+    {
+        count -= removed;
+        Stats::recordRemove(static_cast<std::uint64_t>(removed));
+        destroyChain(doomed);
+        throw;
+    }
+
+    count -= removed;
+    Stats::recordRemove(static_cast<std::uint64_t>(removed));
+    destroyChain(doomed);
+    return removed;
+}
+
+template <typename T, typename Allocator, typename Stats>
+ListItr<T> List<T, Allocator, Stats>::erase(ListItr<T> position)
+{
+    if (position.isPastEnd() || position.isPastBeginning())
+    {
+        throw std::invalid_argument("Cannot erase a dummy head or tail node.");
+    }
+
+    ListNode<T> *next = position.current->next;
+    position.current->previous->next = next;
+    next->previous = position.current->previous;
+    destroyNode(position.current);
+    count--;
+    Stats::recordRemove();
+    return ListItr<T>(next);
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::moveToFront(ListItr<T> position)
+{
+    if (position.isPastEnd() || position.isPastBeginning())
+    {
+        throw std::invalid_argument("Cannot move a dummy head or tail node.");
+    }
+
+    ListNode<T> *node = position.current;
+    if (head->next == node)
+    {
+        return;
+    }
+
+    node->previous->next = node->next;
+    node->next->previous = node->previous;
+    node->previous = head;
+    node->next = head->next;
+    head->next->previous = node;
+    head->next = node;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::splice(ListItr<T> position, List<T, Allocator, Stats> &source)
+{
+    if (position.isPastBeginning())
+    {
+        throw std::invalid_argument("Cannot splice before the dummy head node.");
+    }
+    checkSamePool(source);
+    if (&source == this || source.isEmpty())
+    {
+        return;
+    }
+
+    relinkBefore(position.current, source.head->next, source.tail->previous);
+    count += source.count;
+    source.count = 0;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::splice(ListItr<T> position, List<T, Allocator, Stats> &source, ListItr<T> element)
+{
+    if (position.isPastBeginning())
+    {
+        throw std::invalid_argument("Cannot splice before the dummy head node.");
+    }
+    if (element.isPastEnd() || element.isPastBeginning())
+    {
+        throw std::invalid_argument("Cannot splice a dummy head or tail node.");
+    }
+    checkSamePool(source);
+    if (element.current == position.current || element.current->next == position.current)
+    {
+        return;
+    }
+
+    relinkBefore(position.current, element.current, element.current);
+    count++;
+    source.count--;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::splice(ListItr<T> position, List<T, Allocator, Stats> &source, ListItr<T> firstElement, ListItr<T> pastLast)
+{
+    if (position.isPastBeginning())
+    {
+        throw std::invalid_argument("Cannot splice before the dummy head node.");
+    }
+    if (firstElement.isPastBeginning())
+    {
+        throw std::invalid_argument("Cannot splice a dummy head or tail node.");
+    }
+    checkSamePool(source);
+    if (firstElement.current == pastLast.current || pastLast.current == position.current)
+    {
+        return;
+    }
+
+    ListNode<T> *lastNode = pastLast.current->previous;
+    if (&source != this)
+    {
+        int moved = 0;
+        for (ListNode<T> *node = firstElement.current; node != pastLast.current; node = node->next)
+        {
+            moved++;
+        }
+        count += moved;
+        source.count -= moved;
+    }
+    relinkBefore(position.current, firstElement.current, lastNode);
+}
+
+template <typename T, typename Allocator, typename Stats>
+List<T, Allocator, Stats> List<T, Allocator, Stats>::splitAt(ListItr<T> position)
+{
+    if (position.isPastBeginning())
+    {
+        throw std::invalid_argument("Cannot split at the dummy head node.");
+    }
+
+    List<T, Allocator, Stats> rest(get_allocator());
+    rest.pool = pool;
+    if (position.isPastEnd())
+    {
+        return rest;
+    }
+
+    // Walk towards both ends in lockstep; whichever sentinel is reached first gives the count
+    ListNode<T> *forward = position.current;
+    ListNode<T> *backward = position.current->previous;
+    int steps = 0;
+    int moved = 0;
+    while (true)
+    {
+        if (forward == tail)
+        {
+            moved = steps;
+            break;
+        }
+        if (backward == head)
+        {
+            moved = count - steps;
+            break;
+        }
+        forward = forward->next;
+        backward = backward->previous;
+        steps++;
+    }
+
+    relinkBefore(rest.tail, position.current, tail->previous);
+    rest.count = moved;
+    count -= moved;
+    return rest;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::merge(List<T, Allocator, Stats> &source)
+{
+    merge(source, std::less<T>());
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename Compare>
+void List<T, Allocator, Stats>::merge(List<T, Allocator, Stats> &source, Compare comp)
+{
+    checkSamePool(source);
+    if (&source == this || source.isEmpty())
+    {
+        return;
+    }
+
+    ensureSentinels();
+    ListNode<T> *mine = head->next;
+    ListNode<T> *theirs = source.head->next;
+    while (theirs != source.tail)
+    {
+        if (mine == tail)
+        {
+            relinkBefore(tail, theirs, source.tail->previous);
+            break;
+        }
+        if (comp(theirs->value, mine->value))
+        {
+            // Move the whole run of source elements that go before `mine` at once
+            ListNode<T> *runEnd = theirs;
+            while (runEnd->next != source.tail && comp(runEnd->next->value, mine->value))
+            {
+                runEnd = runEnd->next;
+            }
+            ListNode<T> *nextTheirs = runEnd->next;
+            relinkBefore(mine, theirs, runEnd);
+            theirs = nextTheirs;
+        }
+        else
+        {
+            mine = mine->next;
+        }
+    }
+
+    count += source.count;
+    source.count = 0;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::sort()
+{
+    sort(std::less<T>());
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename Compare>
+void List<T, Allocator, Stats>::sort(Compare comp)
+{
+    if (count < 2)
+    {
+        return;
+    }
+
+    // bins[i] is null or a sorted chain merged from 2^i runs; higher bins hold earlier elements
+    const int binCount = 64;
+    ListNode<T> *bins[binCount] = {};
+    ListNode<T> *carry = nullptr;
+    ListNode<T> *sorted = nullptr;
+    ListNode<T> *unsorted = head->next;
+    tail->previous->next = nullptr;
+
+    try
+    {
+        while (unsorted != nullptr)
+        {
+            // Take the longest non-descending run, so already sorted stretches cost one pass
+            ListNode<T> *runEnd = unsorted;
+            while (runEnd->next != nullptr && !comp(runEnd->next->value, runEnd->value))
+            {
+                runEnd = runEnd->next;
+            }
+            carry = unsorted;
+            unsorted = runEnd->next;
+            runEnd->next = nullptr;
+
+            int bin = 0;
+            while (bins[bin] != nullptr)
+            {
+                mergeChains(bins[bin], carry, comp);
+                carry = bins[bin];
+                bins[bin] = nullptr;
+                bin++;
+            }
+            bins[bin] = carry;
+            carry = nullptr;
+        }
+
+        for (int bin = 0; bin < binCount; bin++)
+        {
+            if (bins[bin] != nullptr)
+            {
+                mergeChains(bins[bin], sorted, comp);
+                sorted = bins[bin];
+                bins[bin] = nullptr;
+            }
+        }
+    }
+    catch (...)
+    {
+        // Put every node back, chain after chain
+        ListNode<T> *chains[binCount + 3];
+        int chainCount = 0;
+        chains[chainCount++] = sorted;
+        chains[chainCount++] = carry;
+        chains[chainCount++] = unsorted;
+        for (int bin = 0; bin < binCount; bin++)
+        {
+            chains[chainCount++] = bins[bin];
+        }
+
+        ListNode<T> *all = nullptr;
+        ListNode<T> **link = &all;
+        for (int i = 0; i < chainCount; i++)
+        {
+            *link = chains[i];
+            while (*link != nullptr)
+            {
+                link = &(*link)->next;
+            }
+        }
+        adoptChain(all);
+        throw;
+    }
+
+    adoptChain(sorted);
+}
+
+template <typename T, typename Allocator, typename Stats>
+int List<T, Allocator, Stats>::size() const
+{
+    return count;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::print(std::ostream &os, bool forward)
+{
+    os<<"";
+
+    if (forward)
+    {
+        exportRange(os, cbegin(), cend());
+    }
+    else
+    {
+        exportRange(os, crbegin(), crend());
+    }
+    os << std::endl;
 }
 
-template <typename T>
-void List<T>::insertBefore(T x, ListItr<T> position)
+template <typename T, typename Allocator, typename Stats>
+template <typename Iterator>
+void List<T, Allocator, Stats>::exportRange(std::ostream &os, Iterator first, Iterator last, const std::string &delimiter) const
 {
-    if (position.isPastBeginning())
+    if (!formatsLikeToChars(os))
     {
-        throw std::invalid_argument("Cannot insert before the beginning of the list.");
+        for (; first != last; ++first)
+        {
+            os << *first << delimiter;
+        }
+        return;
     }
 
-    ListNode<T> *newNode = new ListNode<T>(x);
-    newNode->next = position.current;
-    newNode->previous = position.current->previous;
-    newNode->previous->next = newNode;
-    position.current->previous = newNode;
-    count++;
+    formatChunks(first, last, delimiter, [&os](const char *data, std::size_t length) {
+        os.write(data, static_cast<std::streamsize>(length));
+    });
 }
 
-template <typename T>
-void List<T>::insertAtTail(T x)
+template <typename T, typename Allocator, typename Stats>
+template <typename Iterator>
+void List<T, Allocator, Stats>::exportRange(int fd, Iterator first, Iterator last, const std::string &delimiter) const
 {
-    insertBefore(x, ListItr<T>(tail));
+    formatChunks(first, last, delimiter, [fd](const char *data, std::size_t length) {
+        while (length > 0)
+        {
+            ssize_t written = ::write(fd, data, length);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                throw std::system_error(errno, std::generic_category(), "Cannot write the list");
+            }
+            data += written;
+            length -= static_cast<std::size_t>(written);
+        }
+    });
 }
 
-template <typename T>
-void List<T>::insertAtFront(T x)
+template <typename T, typename Allocator, typename Stats>
+template <typename Iterator, typename Writer>
+void List<T, Allocator, Stats>::formatChunks(Iterator first, Iterator last, const std::string &delimiter, Writer write)
+{
+    // Room for the longest formatted value plus one delimiter past the flush threshold
+    const std::size_t reserve = 128 + delimiter.size();
+    std::vector<char> buffer(exportChunkBytes + reserve);
+    char *const begin = buffer.data();
+    char *const threshold = begin + exportChunkBytes;
+    char *const end = threshold + reserve;
+    char *cursor = begin;
+    std::ostringstream text;
+
+    for (; first != last; ++first)
+    {
+        if constexpr (numericText)
+        {
+            std::to_chars_result result;
+            if constexpr (std::is_same<T, bool>::value)
+            {
+                result = std::to_chars(cursor, end, static_cast<int>(*first));
+            }
+            else if constexpr (std::is_floating_point<T>::value)
+            {
+                result = std::to_chars(cursor, end, *first, std::chars_format::general, 6);
+            }
+            else
+            {
+                result = std::to_chars(cursor, end, *first);
+            }
+            cursor = result.ptr;
+        }
+        else
+        {
+            text.str(std::string());
+            text << *first;
+            const std::string &formatted = text.str();
+            if (static_cast<std::size_t>(end - cursor) < formatted.size() + delimiter.size())
+            {
+                write(begin, static_cast<std::size_t>(cursor - begin));
+                cursor = begin;
+                if (formatted.size() + delimiter.size() > static_cast<std::size_t>(end - begin))
+                {
+                    write(formatted.data(), formatted.size());
+                    write(delimiter.data(), delimiter.size());
+                    continue;
+                }
+            }
+            std::memcpy(cursor, formatted.data(), formatted.size());
+            cursor += formatted.size();
+        }
+
+        std::memcpy(cursor, delimiter.data(), delimiter.size());
+        cursor += delimiter.size();
+        if (cursor >= threshold)
+        {
+            write(begin, static_cast<std::size_t>(cursor - begin));
+            cursor = begin;
+        }
+    }
+    if (cursor != begin)
+    {
+        write(begin, static_cast<std::size_t>(cursor - begin));
+    }
+}
+
+template <typename T, typename Allocator, typename Stats>
+bool List<T, Allocator, Stats>::formatsLikeToChars(const std::ostream &os)
 {
-    insertAfter(x, ListItr<T>(head));
+    return numericText && os.flags() == (std::ios_base::dec | std::ios_base::skipws) && os.precision() == 6 &&
+           os.width() == 0 && os.getloc() == std::locale::classic();
 }
 
-template <typename T>
-ListItr<T> List<T>::find(T x)
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::save(std::ostream &os) const
 {
-    ListItr<T> iter = first();
-    while (!iter.isPastEnd() && iter.retrieve() != x)
+    static_assert(std::is_trivially_copyable<T>::value || std::is_same<T, std::string>::value,
+                  "List::save supports trivially copyable element types and std::string.");
+
+    unsigned char header[24];
+    const std::uint16_t typeTag = snapshotTypeTag();
+    const std::uint32_t elementSize = sizeof(T);
+    const std::uint32_t byteOrder = 0x01020304;
+    const std::uint64_t elements = static_cast<std::uint64_t>(count);
+    std::memcpy(header, "DLLS", 4);
+    std::memcpy(header + 4, &snapshotVersion, 2);
+    std::memcpy(header + 6, &typeTag, 2);
+    std::memcpy(header + 8, &elementSize, 4);
+    std::memcpy(header + 12, &byteOrder, 4);
+    std::memcpy(header + 16, &elements, 8);
+    os.write(reinterpret_cast<const char *>(header), sizeof(header));
+
+    std::vector<char> chunk;
+    chunk.reserve(snapshotChunkBytes);
+    for (const ListNode<T> *node = frontNode(); node != tail && os; node = node->next)
     {
-        iter.moveForward();
+        if constexpr (std::is_same<T, std::string>::value)
+        {
+            const std::uint64_t length = node->value.size();
+            const char *lengthBytes = reinterpret_cast<const char *>(&length);
+            chunk.insert(chunk.end(), lengthBytes, lengthBytes + sizeof(length));
+            if (length >= snapshotChunkBytes)
+            {
+                os.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+                os.write(node->value.data(), static_cast<std::streamsize>(length));
+                chunk.clear();
+                continue;
+            }
+            chunk.insert(chunk.end(), node->value.begin(), node->value.end());
+        }
+        else
+        {
+            const char *bytes = reinterpret_cast<const char *>(&node->value);
+            chunk.insert(chunk.end(), bytes, bytes + sizeof(T));
+        }
+
+        if (chunk.size() >= snapshotChunkBytes)
+        {
+            os.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+            chunk.clear();
+        }
+    }
+    os.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+
+    if (!os)
+    {
+        throw std::runtime_error("Failed to write the list snapshot.");
     }
-    return iter;
 }
 
-template <typename T>
-void List<T>::remove(T x)
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::save(const std::string &path) const
 {
-    ListItr<T> iter = find(x);
-    if (!iter.isPastEnd())
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        throw std::runtime_error("Cannot open " + path + " for writing.");
+    }
+    save(file);
+    file.close();
+    if (!file)
     {
-        iter.current->previous->next = iter.current->next;
-        iter.current->next->previous = iter.current->previous;
-        delete iter.current;
-        count--;
+        throw std::runtime_error("Failed to write the list snapshot to " + path + ".");
     }
 }
 
-template <typename T>
-int List<T>::size() const
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::load(std::istream &is)
 {
-    return count;
+    static_assert(std::is_trivially_copyable<T>::value || std::is_same<T, std::string>::value,
+                  "List::load supports trivially copyable element types and std::string.");
+
+    auto readExactly = [&is](void *destination, std::size_t bytes) {
+        if (!is.read(static_cast<char *>(destination), static_cast<std::streamsize>(bytes)))
+        {
+            throw std::runtime_error("The list snapshot is truncated.");
+        }
+    };
+
+    unsigned char header[24];
+    readExactly(header, sizeof(header));
+    std::uint16_t version;
+    std::uint16_t typeTag;
+    std::uint32_t elementSize;
+    std::uint32_t byteOrder;
+    std::uint64_t elements;
+    std::memcpy(&version, header + 4, 2);
+    std::memcpy(&typeTag, header + 6, 2);
+    std::memcpy(&elementSize, header + 8, 4);
+    std::memcpy(&byteOrder, header + 12, 4);
+    std::memcpy(&elements, header + 16, 8);
+
+    if (std::memcmp(header, "DLLS", 4) != 0 || byteOrder != 0x01020304)
+    {
+        throw std::runtime_error("The data is not a list snapshot for this platform.");
+    }
+    if (version != snapshotVersion)
+    {
+        throw std::runtime_error("Unsupported list snapshot version.");
+    }
+    if (typeTag != snapshotTypeTag() || elementSize != sizeof(T))
+    {
+        throw std::runtime_error("The list snapshot holds a different element type.");
+    }
+    if (elements > static_cast<std::uint64_t>(std::numeric_limits<int>::max()))
+    {
+        throw std::runtime_error("The list snapshot holds more elements than a List can.");
+    }
+
+    // A corrupt or truncated header must not get to reserve memory for values that are not there
+    std::uint64_t available = bytesLeftIn(is);
+    std::uint64_t leastBytes = elements * (std::is_same<T, std::string>::value ? sizeof(std::uint64_t) : sizeof(T));
+    if (leastBytes > available)
+    {
+        throw std::runtime_error("The list snapshot is truncated.");
+    }
+    if (pool != nullptr && available != std::numeric_limits<std::uint64_t>::max())
+    {
+        pool->reserveContiguous(static_cast<std::size_t>(elements));
+    }
+
+    List<T, Allocator, Stats> loaded(get_allocator());
+    loaded.pool = pool;
+    std::size_t perChunk = std::is_same<T, std::string>::value ? 4096 : snapshotChunkBytes / sizeof(T);
+    if (perChunk == 0)
+    {
+        perChunk = 1;
+    }
+    std::vector<T> chunk;
+    std::uint64_t remaining = elements;
+    while (remaining > 0)
+    {
+        std::size_t size = remaining < perChunk ? static_cast<std::size_t>(remaining) : perChunk;
+        chunk.resize(size);
+        if constexpr (std::is_same<T, std::string>::value)
+        {
+            for (std::string &value : chunk)
+            {
+                std::uint64_t length;
+                readExactly(&length, sizeof(length));
+                if (length > available)
+                {
+                    throw std::runtime_error("The list snapshot is truncated.");
+                }
+
+                // Grow the string only as its bytes arrive, in case the stream cannot tell how many are left
+                value.clear();
+                while (value.size() < length)
+                {
+                    std::size_t filled = value.size();
+                    std::size_t piece = static_cast<std::size_t>(
+                        std::min<std::uint64_t>(length - filled, static_cast<std::uint64_t>(snapshotChunkBytes)));
+                    value.resize(filled + piece);
+                    readExactly(&value[filled], piece);
+                }
+            }
+        }
+        else
+        {
+            readExactly(chunk.data(), size * sizeof(T));
+        }
+
+        ListNode<T> *lastNode;
+        int built;
+        ListNode<T> *firstNode = loaded.buildChain(std::make_move_iterator(chunk.begin()),
+                                                   std::make_move_iterator(chunk.end()), lastNode, built);
+        loaded.linkChainBefore(loaded.tail, firstNode, lastNode, built);
+        remaining -= size;
+    }
+
+    makeEmpty();
+    takeNodes(loaded);
 }
 
-template <typename T>
-void List<T>::print(std::ostream &os, bool forward)
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::load(const std::string &path)
 {
-    os<<"";
-    
-    if (forward)
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        throw std::runtime_error("Cannot open " + path + " for reading.");
+    }
+    load(file);
+}
+
+template <typename T, typename Allocator, typename Stats>
+std::uint64_t List<T, Allocator, Stats>::bytesLeftIn(std::istream &is)
+{
+    const std::istream::pos_type unknown(-1);
+    std::istream::pos_type here = is.tellg();
+    if (here == unknown)
+    {
+        return std::numeric_limits<std::uint64_t>::max();
+    }
+    is.seekg(0, std::ios::end);
+    std::istream::pos_type end = is.tellg();
+    is.clear();
+    is.seekg(here);
+    if (end == unknown)
+    {
+        return std::numeric_limits<std::uint64_t>::max();
+    }
+    return static_cast<std::uint64_t>(end - here);
+}
+
+template <typename T, typename Allocator, typename Stats>
+constexpr std::uint16_t List<T, Allocator, Stats>::snapshotTypeTag()
+{
+    if (std::is_same<T, std::string>::value)
+    {
+        return 5;
+    }
+    if (std::is_floating_point<T>::value)
+    {
+        return 3;
+    }
+    if (std::is_integral<T>::value)
+    {
+        return std::is_signed<T>::value ? 1 : 2;
+    }
+    return 4;
+}
+
+template <typename T, typename Allocator, typename Stats>
+ListNodePool<T> *List<T, Allocator, Stats>::nodePool() const
+{
+    return pool;
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename... Args>
+ListNode<T> *List<T, Allocator, Stats>::createNode(Args &&...args)
+{
+    ListNode<T> *node;
+    if (pool == nullptr)
+    {
+        node = newNode(allocator, std::forward<Args>(args)...);
+    }
+    else
     {
-        for (ListItr<T> itr = first(); !itr.isPastEnd(); itr.moveForward())
+        ListNode<T> *storage = pool->allocate();
+        try
+        {
+            node = new (storage) ListNode<T>(std::forward<Args>(args)...);
+        }
+        catch (...)
         {
-            os << itr.retrieve() << " ";
+            pool->deallocate(storage);
+            throw;
         }
     }
+    Stats::recordAllocation();
+    return node;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::destroyNode(ListNode<T> *node)
+{
+    if (pool == nullptr)
+    {
+        deleteNode(allocator, node);
+    }
     else
     {
-        for (ListItr<T> itr = last(); !itr.isPastBeginning(); itr.moveBackward())
+        node->~ListNode<T>();
+        pool->deallocate(node);
+    }
+    Stats::recordFree();
+}
+
+template <typename T, typename Allocator, typename Stats>
+typename List<T, Allocator, Stats>::allocator_type List<T, Allocator, Stats>::get_allocator() const
+{
+    return allocator_type(allocator);
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::swap(List<T, Allocator, Stats> &other)
+{
+    if constexpr (NodeTraits::propagate_on_container_swap::value)
+    {
+        using std::swap;
+        swap(allocator, other.allocator);
+    }
+    else if (allocator != other.allocator)
+    {
+        throw std::invalid_argument("Cannot swap lists with unequal allocators that do not propagate on swap.");
+    }
+    std::swap(head, other.head);
+    std::swap(tail, other.tail);
+    std::swap(count, other.count);
+    std::swap(pool, other.pool);
+}
+
+template <typename T, typename Allocator, typename Stats>
+ListStatsSnapshot List<T, Allocator, Stats>::statistics() const
+{
+    ListStatsSnapshot snapshot = Stats::snapshot();
+    if (Stats::enabled)
+    {
+        snapshot.bytesHeld = (static_cast<std::uint64_t>(count) + 2) * sizeof(ListNode<T>);
+    }
+    return snapshot;
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename... Args>
+ListNode<T> *List<T, Allocator, Stats>::newNode(NodeAllocator &alloc, Args &&...args)
+{
+    ListNode<T> *node = NodeTraits::allocate(alloc, 1);
+    try
+    {
+        NodeTraits::construct(alloc, node, std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        NodeTraits::deallocate(alloc, node, 1);
+        throw;
+    }
+    return node;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::deleteNode(NodeAllocator &alloc, ListNode<T> *node)
+{
+    NodeTraits::destroy(alloc, node);
+    NodeTraits::deallocate(alloc, node, 1);
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::createSentinels()
+{
+    ListNode<T> *newHead = newNode(allocator);
+    ListNode<T> *newTail;
+    try
+    {
+        newTail = newNode(allocator);
+    }
+    catch (...)
+    {
+        deleteNode(allocator, newHead);
+        throw;
+    }
+    head = newHead;
+    tail = newTail;
+    head->next = tail;
+    tail->previous = head;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::ensureSentinels()
+{
+    if (head == nullptr)
+    {
+        createSentinels();
+    }
+}
+
+template <typename T, typename Allocator, typename Stats>
+ListNode<T> *List<T, Allocator, Stats>::frontNode() const
+{
+    return head == nullptr ? tail : head->next;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::replaceAllocator(const NodeAllocator &replacement)
+{
+    NodeAllocator adopted(replacement);
+    ListNode<T> *newHead = newNode(adopted);
+    ListNode<T> *newTail;
+    try
+    {
+        newTail = newNode(adopted);
+    }
+    catch (...)
+    {
+        deleteNode(adopted, newHead);
+        throw;
+    }
+
+    deleteNode(allocator, tail);
+    deleteNode(allocator, head);
+    allocator = adopted;
+    head = newHead;
+    tail = newTail;
+    head->next = tail;
+    tail->previous = head;
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename Visitor>
+ListNode<T> *List<T, Allocator, Stats>::scanNodes(Visitor visit) const
+{
+    ListNode<T> *node = frontNode();
+    while (node != tail)
+    {
+        ListNode<T> *next = node->next;
+        prefetchForRead(next);
+        if (visit(node))
         {
-            os << itr.retrieve() << " ";
+            return node;
         }
+        node = next;
     }
-    os << std::endl;
+    return node;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::destroyChain(ListNode<T> *chain)
+{
+    if (pool == nullptr)
+    {
+        while (chain != nullptr)
+        {
+            ListNode<T> *next = chain->next;
+            deleteNode(allocator, chain);
+            Stats::recordFree();
+            chain = next;
+        }
+        return;
+    }
+
+    typename ListNodePool<T>::FreeBatch batch;
+    while (chain != nullptr)
+    {
+        ListNode<T> *next = chain->next;
+        chain->~ListNode<T>();
+        batch.add(chain);
+        Stats::recordFree();
+        chain = next;
+    }
+    pool->deallocate(batch);
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::takeNodes(List<T, Allocator, Stats> &source)
+{
+    if (source.isEmpty())
+    {
+        return;
+    }
+
+    ListNode<T> *firstNode = source.head->next;
+    ListNode<T> *lastNode = source.tail->previous;
+    source.head->next = source.tail;
+    source.tail->previous = source.head;
+
+    firstNode->previous = tail->previous;
+    tail->previous->next = firstNode;
+    lastNode->next = tail;
+    tail->previous = lastNode;
+
+    count += source.count;
+    source.count = 0;
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename InputIt>
+ListNode<T> *List<T, Allocator, Stats>::buildChain(InputIt first, InputIt last, ListNode<T> *&lastNode, int &built)
+{
+    ListNode<T> *firstNode = nullptr;
+    lastNode = nullptr;
+    built = 0;
+
+    bool contiguous = false;
+    if constexpr (std::is_base_of<std::forward_iterator_tag,
+                                  typename std::iterator_traits<InputIt>::iterator_category>::value)
+    {
+        if (pool != nullptr)
+        {
+            pool->reserveContiguous(static_cast<std::size_t>(std::distance(first, last)));
+            contiguous = true;
+        }
+    }
+
+    try
+    {
+        for (; first != last; ++first)
+        {
+            ListNode<T> *node;
+            if (contiguous)
+            {
+                ListNode<T> *storage = pool->allocateFresh();
+                try
+                {
+                    node = new (storage) ListNode<T>(*first);
+                    Stats::recordAllocation();
+                }
+                catch (...)
+                {
+                    pool->deallocate(storage);
+                    throw;
+                }
+            }
+            else
+            {
+                node = createNode(*first);
+            }
+
+            node->previous = lastNode;
+            if (lastNode == nullptr)
+            {
+                firstNode = node;
+            }
+            else
+            {
+                lastNode->next = node;
+            }
+            lastNode = node;
+            built++;
+        }
+    }
+    catch (...)
+    {
+        while (firstNode != nullptr)
+        {
+            ListNode<T> *next = firstNode->next;
+            destroyNode(firstNode);
+            firstNode = next;
+        }
+        throw;
+    }
+    return firstNode;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::linkChainBefore(ListNode<T> *position, ListNode<T> *firstNode, ListNode<T> *lastNode, int built)
+{
+    if (firstNode == nullptr)
+    {
+        return;
+    }
+
+    firstNode->previous = position->previous;
+    position->previous->next = firstNode;
+    lastNode->next = position;
+    position->previous = lastNode;
+    count += built;
+    Stats::recordRangeInsert(static_cast<std::uint64_t>(built));
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::relinkBefore(ListNode<T> *position, ListNode<T> *firstNode, ListNode<T> *lastNode)
+{
+    firstNode->previous->next = lastNode->next;
+    lastNode->next->previous = firstNode->previous;
+
+    firstNode->previous = position->previous;
+    position->previous->next = firstNode;
+    lastNode->next = position;
+    position->previous = lastNode;
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename Compare>
+void List<T, Allocator, Stats>::mergeChains(ListNode<T> *&first, ListNode<T> *&second, Compare &comp)
+{
+    ListNode<T> *merged = nullptr;
+    ListNode<T> **link = &merged;
+    ListNode<T> *a = first;
+    ListNode<T> *b = second;
+    try
+    {
+        while (a != nullptr && b != nullptr)
+        {
+            if (comp(b->value, a->value))
+            {
+                *link = b;
+                link = &b->next;
+                b = b->next;
+            }
+            else
+            {
+                *link = a;
+                link = &a->next;
+                a = a->next;
+            }
+        }
+        *link = a != nullptr ? a : b;
+    }
+    catch (...)
+    {
+        *link = a;
+        while (*link != nullptr)
+        {
+            link = &(*link)->next;
+        }
+        *link = b;
+        first = merged;
+        second = nullptr;
+        throw;
+    }
+    first = merged;
+    second = nullptr;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::adoptChain(ListNode<T> *chain)
+{
+    ListNode<T> *previous = head;
+    for (ListNode<T> *node = chain; node != nullptr; node = node->next)
+    {
+        node->previous = previous;
+        previous->next = node;
+        previous = node;
+    }
+    previous->next = tail;
+    tail->previous = previous;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void List<T, Allocator, Stats>::checkSamePool(const List<T, Allocator, Stats> &source) const
+{
+    if (source.pool != pool)
+    {
+        throw std::invalid_argument("Cannot relink nodes between lists with different node pools.");
+    }
+    if (pool == nullptr && allocator != source.allocator)
+    {
+        throw std::invalid_argument("Cannot relink nodes between lists with unequal allocators.");
+    }
+}
+
+/**
+ * @brief Exchanges the contents of two lists. See List::swap.
+ *
+ * @param lhs The first list.
+ * @param rhs The second list.
+ */
+template <typename T, typename Allocator, typename Stats>
+void swap(List<T, Allocator, Stats> &lhs, List<T, Allocator, Stats> &rhs)
+{
+    lhs.swap(rhs);
 }
 
+namespace pmr
+{
+/**
+ * @brief A List whose nodes come from a std::pmr::memory_resource.
+ *
+ * List.h brings namespace std into the global namespace, so spell this alias `::pmr::List` to avoid
+ * ambiguity with std::pmr.
+ */
+template <typename T>
+using List = ::List<T, std::pmr::polymorphic_allocator<T>>;
+} // namespace pmr
+
 #endif
\ No newline at end of file
@@ -0,0 +1,200 @@
+#ifndef LISTITERATOR_H
+#define LISTITERATOR_H
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "ListNode.h"
+
+template <typename T, typename Allocator, typename Stats>
+class List;
+
+template <typename T>
+class ListNode;
+
+/**
+ * @class ListIterator
+ * @brief Standard bidirectional iterator over the elements of a List.
+ *
+ * Unlike ListItr, a ListIterator does no bounds checks: incrementing follows `next` and
+ * decrementing follows `previous`, and the end of the list is the dummy tail node. That makes it
+ * usable with <algorithm>, <numeric> and range-for, and keeps a loop over it a plain pointer chase.
+ * `IsConst` selects between the `iterator` and `const_iterator` of List.
+ */
+template <typename T, bool IsConst>
+class ListIterator
+{
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::conditional<IsConst, const T *, T *>::type;
+    using reference = typename std::conditional<IsConst, const T &, T &>::type;
+
+    /**
+     * @brief Default constructor.
+     *
+     * Constructs a singular iterator that points to nullptr.
+     */
+    ListIterator();
+
+    /**
+     * @brief Constructor for an iterator at a given node.
+     *
+     * @param theNode The node to point to.
+     */
+    explicit ListIterator(ListNode<T> *theNode);
+
+    /**
+     * @brief Converts an `iterator` into a `const_iterator`.
+     *
+     * @param other The iterator to convert.
+     */
+    template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+    ListIterator(const ListIterator<T, OtherConst> &other);
+
+    /**
+     * @brief Returns the value at the current position.
+     *
+     * @return Reference to the value.
+     */
+    reference operator*() const;
+
+    /**
+     * @brief Accesses a member of the value at the current position.
+     *
+     * @return Pointer to the value.
+     */
+    pointer operator->() const;
+
+    /**
+     * @brief Moves to the next node.
+     *
+     * @return Reference to this iterator.
+     */
+    ListIterator &operator++();
+
+    /**
+     * @brief Moves to the next node.
+     *
+     * @return A copy of this iterator from before the move.
+     */
+    ListIterator operator++(int);
+
+    /**
+     * @brief Moves to the previous node.
+     *
+     * @return Reference to this iterator.
+     */
+    ListIterator &operator--();
+
+    /**
+     * @brief Moves to the previous node.
+     *
+     * @return A copy of this iterator from before the move.
+     */
+    ListIterator operator--(int);
+
+    /**
+     * @brief Checks whether two iterators point to the same node.
+     *
+     * @param other The iterator to compare with.
+     * @return True if both point to the same node.
+     */
+    template <bool OtherConst>
+    bool operator==(const ListIterator<T, OtherConst> &other) const;
+
+    /**
+     * @brief Checks whether two iterators point to different nodes.
+     *
+     * @param other The iterator to compare with.
+     * @return True if they point to different nodes.
+     */
+    template <bool OtherConst>
+    bool operator!=(const ListIterator<T, OtherConst> &other) const;
+
+private:
+    ListNode<T> *current; /**< Holds the position in the list. */
+
+    template <typename, typename, typename>
+    friend class List;                      /**< List needs access to "current". */
+    friend class ListIterator<T, !IsConst>; /**< Conversions and comparisons need access to "current". */
+};
+
+template <typename T, bool IsConst>
+ListIterator<T, IsConst>::ListIterator()
+{
+    current = nullptr;
+}
+
+template <typename T, bool IsConst>
+ListIterator<T, IsConst>::ListIterator(ListNode<T> *theNode)
+{
+    current = theNode;
+}
+
+template <typename T, bool IsConst>
+template <bool OtherConst, typename>
+ListIterator<T, IsConst>::ListIterator(const ListIterator<T, OtherConst> &other)
+{
+    current = other.current;
+}
+
+template <typename T, bool IsConst>
+typename ListIterator<T, IsConst>::reference ListIterator<T, IsConst>::operator*() const
+{
+    return current->value;
+}
+
+template <typename T, bool IsConst>
+typename ListIterator<T, IsConst>::pointer ListIterator<T, IsConst>::operator->() const
+{
+    return &current->value;
+}
+
+template <typename T, bool IsConst>
+ListIterator<T, IsConst> &ListIterator<T, IsConst>::operator++()
+{
+    current = current->next;
+    return *this;
+}
+
+template <typename T, bool IsConst>
+ListIterator<T, IsConst> ListIterator<T, IsConst>::operator++(int)
+{
+    ListIterator<T, IsConst> old = *this;
+    current = current->next;
+    return old;
+}
+
+template <typename T, bool IsConst>
+ListIterator<T, IsConst> &ListIterator<T, IsConst>::operator--()
+{
+    current = current->previous;
+    return *this;
+}
+
+template <typename T, bool IsConst>
+ListIterator<T, IsConst> ListIterator<T, IsConst>::operator--(int)
+{
+    ListIterator<T, IsConst> old = *this;
+    current = current->previous;
+    return old;
+}
+
+template <typename T, bool IsConst>
+template <bool OtherConst>
+bool ListIterator<T, IsConst>::operator==(const ListIterator<T, OtherConst> &other) const
+{
+    return current == other.current;
+}
+
+template <typename T, bool IsConst>
+template <bool OtherConst>
+bool ListIterator<T, IsConst>::operator!=(const ListIterator<T, OtherConst> &other) const
+{
+    return current != other.current;
+}
+
+#endif
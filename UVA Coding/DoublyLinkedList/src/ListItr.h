@@ -4,7 +4,7 @@
 #include "ListNode.h"
 #include "List.h"
 
-template<typename T>
+template <typename T, typename Allocator, typename Stats>
 class List;
 
 template<typename T>
@@ -69,14 +69,32 @@ public:
     /**
      * @brief Retrieves the value at the current position of the list.
      *
-     * @return The value at the current position.
+     * The value is returned by reference, so looking it up never copies it.
+     * @return Reference to the value at the current position.
+     */
+    T &retrieve() const;
+
+    /**
+     * @brief Checks whether two iterators point to the same position.
+     *
+     * @param rhs The iterator to compare with.
+     * @return True if both iterators point to the same ListNode.
+     */
+    bool operator==(const ListItr &rhs) const;
+
+    /**
+     * @brief Checks whether two iterators point to different positions.
+     *
+     * @param rhs The iterator to compare with.
+     * @return True if the iterators point to different ListNodes.
      */
-    T retrieve() const;
+    bool operator!=(const ListItr &rhs) const;
 
 private:
     ListNode<T> *current; /**< Holds the position in the list. */
 
-    friend class List<T>; /**< List class needs access to "current". */
+    template <typename, typename, typename>
+    friend class List; /**< List class needs access to "current". */
 };
 
 template <typename T>
@@ -122,7 +140,7 @@ void ListItr<T>::moveBackward()
 }
 
 template <typename T>
-T ListItr<T>::retrieve() const
+T &ListItr<T>::retrieve() const
 {
     if (current != nullptr)
     {
@@ -134,4 +152,16 @@ T ListItr<T>::retrieve() const
     }
 }
 
+template <typename T>
+bool ListItr<T>::operator==(const ListItr<T> &rhs) const
+{
+    return current == rhs.current;
+}
+
+template <typename T>
+bool ListItr<T>::operator!=(const ListItr<T> &rhs) const
+{
+    return current != rhs.current;
+}
+
 #endif
\ No newline at end of file
@@ -2,12 +2,15 @@
 #define LISTNODE_H
 
 #include <iostream>
+#include <utility>
 #include "List.h"
 
-template<typename T>
+template <typename T, typename Allocator, typename Stats>
 class List;
 template<typename T>
 class ListItr;
+template<typename T, bool IsConst>
+class ListIterator;
 
 /**
  * @class ListNode
@@ -21,26 +24,32 @@ class ListNode
 {
 public:
     /**
-     * @brief Default constructor for ListNode.
+     * @brief Constructor for ListNode.
      *
-     * Constructs a ListNode object with given value.
+     * Constructs the value in place from `args` (a default-constructed value if there are none),
+     * so that inserting a temporary or emplacing never goes through an extra copy.
+     * @param args The arguments forwarded to the constructor of T.
      */
-    ListNode(T x = T());
+    template <typename... Args>
+    explicit ListNode(Args &&...args);
 
 private:
     T value;               /**< The value of the node. */
     ListNode<T> *next;     /**< Pointer to the next ListNode in the list. */
     ListNode<T> *previous; /**< Pointer to the previous ListNode in the list. */
 
-    friend class List<T>;    /**< List needs access to value, next, and previous. */
+    template <typename, typename, typename>
+    friend class List;       /**< List needs access to value, next, and previous. */
     friend class ListItr<T>; /**< ListItr needs access to value. */
+    template <typename, bool>
+    friend class ListIterator; /**< ListIterator needs access to value, next, and previous. */
 };
 
 
 template <typename T>
-ListNode<T>::ListNode(T x)
+template <typename... Args>
+ListNode<T>::ListNode(Args &&...args) : value(std::forward<Args>(args)...)
 {
-    value = x;
     next = nullptr;
     previous = nullptr;
 }
@@ -0,0 +1,207 @@
+#ifndef LISTSTATS_H
+#define LISTSTATS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+/**
+ * @brief Where an element inserted one at a time landed in the list.
+ */
+enum class ListInsertion
+{
+    Front,  /**< Right after the dummy head (insertAtFront, emplaceFront, insertAfter the head). */
+    Tail,   /**< Right before the dummy tail (insertAtTail, emplaceBack, insertBefore the tail). */
+    Before, /**< Before some other element (insertBefore, emplaceBefore). */
+    After   /**< After some other element (insertAfter, emplaceAfter). */
+};
+
+/**
+ * @brief Copy of the counters of a List statistics policy at one point in time.
+ */
+struct ListStatsSnapshot
+{
+    std::uint64_t allocations = 0;    /**< Element nodes allocated, from the allocator or a node pool. */
+    std::uint64_t frees = 0;          /**< Element nodes freed. */
+    std::uint64_t insertsAtFront = 0; /**< Single elements inserted at the front. */
+    std::uint64_t insertsAtTail = 0;  /**< Single elements inserted at the tail. */
+    std::uint64_t insertsBefore = 0;  /**< Single elements inserted before an element. */
+    std::uint64_t insertsAfter = 0;   /**< Single elements inserted after an element. */
+    std::uint64_t rangeInserts = 0;   /**< Elements linked in by range constructors, assign, insertRange and copies. */
+    std::uint64_t finds = 0;          /**< Calls to find and findIf, including the ones made by remove. */
+    std::uint64_t findHops = 0;       /**< Nodes visited by those calls. */
+    std::uint64_t maxFindHops = 0;    /**< Most nodes visited by a single call. */
+    std::uint64_t removes = 0;        /**< Elements removed by remove, erase, removeIf, removeAll and unique. */
+    std::uint64_t removeMisses = 0;   /**< Calls to remove that found nothing to remove. */
+    std::uint64_t copies = 0;         /**< Copy constructions and copy assignments of the list. */
+    std::uint64_t elementsCopied = 0; /**< Elements copied by those copies. */
+    std::uint64_t bytesHeld = 0;      /**< Bytes of the nodes the list holds now, dummy head and tail included. */
+
+    /**
+     * @brief Returns the average number of nodes visited per find.
+     *
+     * @return findHops / finds, or 0 if there was no find.
+     */
+    double averageFindHops() const
+    {
+        return finds == 0 ? 0.0 : static_cast<double>(findHops) / static_cast<double>(finds);
+    }
+
+    /**
+     * @brief Formats the counters as a single-line JSON object.
+     *
+     * @return The JSON text.
+     */
+    std::string toJson() const
+    {
+        std::ostringstream json;
+        json << "{\"allocations\":" << allocations << ",\"frees\":" << frees << ",\"insertsAtFront\":" << insertsAtFront
+             << ",\"insertsAtTail\":" << insertsAtTail << ",\"insertsBefore\":" << insertsBefore
+             << ",\"insertsAfter\":" << insertsAfter << ",\"rangeInserts\":" << rangeInserts << ",\"finds\":" << finds
+             << ",\"findHops\":" << findHops << ",\"averageFindHops\":" << averageFindHops()
+             << ",\"maxFindHops\":" << maxFindHops << ",\"removes\":" << removes << ",\"removeMisses\":" << removeMisses
+             << ",\"copies\":" << copies << ",\"elementsCopied\":" << elementsCopied << ",\"bytesHeld\":" << bytesHeld
+             << "}";
+        return json.str();
+    }
+};
+
+/**
+ * @class NoListStats
+ * @brief The default statistics policy of List: records nothing.
+ *
+ * Every hook is an empty inline function and the class has no data, so List (which derives from its policy
+ * to get the empty base optimization) is neither larger nor slower than without a policy.
+ */
+class NoListStats
+{
+public:
+    static constexpr bool enabled = false; /**< Whether the policy records anything. */
+
+    // The hooks List calls; CountingListStats documents what each one counts
+    void recordAllocation(std::uint64_t = 1) {}
+    void recordFree(std::uint64_t = 1) {}
+    void recordInsert(ListInsertion) {}
+    void recordRangeInsert(std::uint64_t) {}
+    void recordFind(std::uint64_t) {}
+    void recordRemove(std::uint64_t = 1) {}
+    void recordRemoveMiss() {}
+    void recordCopy(std::uint64_t) {}
+
+    /**
+     * @brief Returns a snapshot with every counter at zero.
+     */
+    ListStatsSnapshot snapshot() const
+    {
+        return ListStatsSnapshot();
+    }
+};
+
+/**
+ * @class CountingListStats
+ * @brief Statistics policy of List that counts allocations, inserts, find walks, removes and copies.
+ *
+ * Use it as `List<T, std::allocator<T>, CountingListStats>` and read the counters with List::statistics().
+ * The counters are plain integers, so a list with this policy is no more thread-safe than any other List.
+ */
+class CountingListStats
+{
+public:
+    static constexpr bool enabled = true; /**< Whether the policy records anything. */
+
+    /**
+     * @brief Counts `nodes` element nodes allocated.
+     */
+    void recordAllocation(std::uint64_t nodes = 1)
+    {
+        counters.allocations += nodes;
+    }
+
+    /**
+     * @brief Counts `nodes` element nodes freed.
+     */
+    void recordFree(std::uint64_t nodes = 1)
+    {
+        counters.frees += nodes;
+    }
+
+    /**
+     * @brief Counts one element inserted at `where`.
+     */
+    void recordInsert(ListInsertion where)
+    {
+        switch (where)
+        {
+        case ListInsertion::Front:
+            counters.insertsAtFront++;
+            break;
+        case ListInsertion::Tail:
+            counters.insertsAtTail++;
+            break;
+        case ListInsertion::Before:
+            counters.insertsBefore++;
+            break;
+        case ListInsertion::After:
+            counters.insertsAfter++;
+            break;
+        }
+    }
+
+    /**
+     * @brief Counts `elements` elements linked in as one chain.
+     */
+    void recordRangeInsert(std::uint64_t elements)
+    {
+        counters.rangeInserts += elements;
+    }
+
+    /**
+     * @brief Counts one find that visited `hops` nodes.
+     */
+    void recordFind(std::uint64_t hops)
+    {
+        counters.finds++;
+        counters.findHops += hops;
+        counters.maxFindHops = std::max(counters.maxFindHops, hops);
+    }
+
+    /**
+     * @brief Counts `elements` elements removed.
+     */
+    void recordRemove(std::uint64_t elements = 1)
+    {
+        counters.removes += elements;
+    }
+
+    /**
+     * @brief Counts one remove that found nothing.
+     */
+    void recordRemoveMiss()
+    {
+        counters.removeMisses++;
+    }
+
+    /**
+     * @brief Counts one copy of the list that copied `elements` elements.
+     */
+    void recordCopy(std::uint64_t elements)
+    {
+        counters.copies++;
+        counters.elementsCopied += elements;
+    }
+
+    /**
+     * @brief Returns a copy of the counters; List::statistics() fills in bytesHeld.
+     */
+    ListStatsSnapshot snapshot() const
+    {
+        return counters;
+    }
+
+private:
+    ListStatsSnapshot counters; /**< The counters recorded so far. */
+};
+
+#endif
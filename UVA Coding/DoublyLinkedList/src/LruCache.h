@@ -0,0 +1,294 @@
+#ifndef LRUCACHE_H
+#define LRUCACHE_H
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+
+#include "List.h"
+
+/**
+ * @brief Default size function for LruCache: the in-object size of the key and the value.
+ */
+template <typename K, typename V>
+struct LruDefaultSizer
+{
+    std::size_t operator()(const K &, const V &) const
+    {
+        return sizeof(K) + sizeof(V);
+    }
+};
+
+/**
+ * @brief Hit, miss and eviction counters of an LruCache.
+ */
+struct LruCacheStats
+{
+    std::size_t hits;      /**< Lookups that found their key. */
+    std::size_t misses;    /**< Lookups that did not find their key. */
+    std::size_t evictions; /**< Entries dropped from the tail to make room. */
+};
+
+/**
+ * @class LruCache
+ * @brief Least-recently-used cache built on a List of entries and a key -> ListItr hash map.
+ *
+ * The List holds entries from most recently used (front) to least recently used (back). A hit
+ * relinks the entry's node to the front in O(1) without allocating, and eviction drops entries from
+ * the back. Capacity is bounded both by entry count and by total bytes, as measured by `Sizer`.
+ * List nodes come from a private node pool and evicted hash-map nodes are reused for the entry that
+ * replaces them, so a cache at capacity makes no heap calls per `put` (beyond copying K and V).
+ */
+template <typename K, typename V, typename Hash = std::hash<K>, typename Sizer = LruDefaultSizer<K, V>>
+class LruCache
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param maxEntries The largest number of entries kept.
+     * @param maxBytes The largest total size of the entries kept, as measured by `sizer`.
+     * @param sizer Function object returning the size of an entry in bytes.
+     */
+    explicit LruCache(std::size_t maxEntries,
+                      std::size_t maxBytes = std::numeric_limits<std::size_t>::max(),
+                      Sizer sizer = Sizer());
+
+    LruCache(const LruCache &) = delete;
+    LruCache &operator=(const LruCache &) = delete;
+
+    /**
+     * @brief Looks up a key and marks it as most recently used.
+     *
+     * @param key The key to look up.
+     * @return Pointer to the cached value, or nullptr on a miss. Valid until the entry is evicted or erased.
+     */
+    V *get(const K &key);
+
+    /**
+     * @brief Checks whether a key is cached, without touching it or the counters.
+     *
+     * @param key The key to look up.
+     * @return True if the key is cached.
+     */
+    bool contains(const K &key) const;
+
+    /**
+     * @brief Inserts or replaces the value for a key and marks it as most recently used.
+     *
+     * Evicts least recently used entries until both capacities are respected.
+     * An entry that alone is larger than the byte capacity is not stored (and any old value for the key is dropped).
+     * @param key The key.
+     * @param value The value.
+     * @return True if the entry was stored.
+     */
+    bool put(const K &key, V value);
+
+    /**
+     * @brief Removes a key from the cache.
+     *
+     * @param key The key to remove.
+     * @return True if the key was cached.
+     */
+    bool erase(const K &key);
+
+    /**
+     * @brief Removes every entry. The counters are kept.
+     */
+    void clear();
+
+    /**
+     * @brief Returns the number of cached entries.
+     *
+     * @return The number of entries.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Returns the total size of the cached entries, as measured by the sizer.
+     *
+     * @return The size in bytes.
+     */
+    std::size_t bytes() const;
+
+    /**
+     * @brief Returns the hit, miss and eviction counters.
+     *
+     * @return A snapshot of the counters.
+     */
+    LruCacheStats stats() const;
+
+    /**
+     * @brief Resets the hit, miss and eviction counters to zero.
+     */
+    void resetStats();
+
+private:
+    struct Entry
+    {
+        K key;
+        V value;
+        std::size_t bytes;
+
+        Entry() : key(), value(), bytes(0) {}
+        Entry(const K &k, V &&v, std::size_t b) : key(k), value(std::move(v)), bytes(b) {}
+    };
+
+    using Map = std::unordered_map<K, ListItr<Entry>, Hash>;
+
+    /**
+     * @brief Drops the least recently used entry.
+     *
+     * @return The map node that held it, for reuse by the caller.
+     */
+    typename Map::node_type evictLeastRecent();
+
+    ListNodePool<Entry> pool; // Node storage for `recency`; declared first so it outlives the list
+    List<Entry> recency;      // Entries, most recently used first
+    Map entries;              // Key -> position of its entry in `recency`
+    Sizer sizer;              // Measures entries for the byte capacity
+    std::size_t entryLimit;   // Capacity by count
+    std::size_t byteLimit;    // Capacity by bytes
+    std::size_t usedBytes;    // Sum of the sizes of the cached entries
+    LruCacheStats counters;   // Hit, miss and eviction counts
+};
+
+template <typename K, typename V, typename Hash, typename Sizer>
+LruCache<K, V, Hash, Sizer>::LruCache(std::size_t maxEntries, std::size_t maxBytes, Sizer entrySizer)
+    : pool(), recency(pool), sizer(entrySizer)
+{
+    entryLimit = maxEntries;
+    byteLimit = maxBytes;
+    usedBytes = 0;
+    counters = LruCacheStats{0, 0, 0};
+    entries.reserve(maxEntries < 1024 * 1024 ? maxEntries : 1024 * 1024);
+}
+
+template <typename K, typename V, typename Hash, typename Sizer>
+V *LruCache<K, V, Hash, Sizer>::get(const K &key)
+{
+    typename Map::iterator found = entries.find(key);
+    if (found == entries.end())
+    {
+        counters.misses++;
+        return nullptr;
+    }
+
+    counters.hits++;
+    recency.moveToFront(found->second);
+    return &found->second.retrieve().value;
+}
+
+template <typename K, typename V, typename Hash, typename Sizer>
+bool LruCache<K, V, Hash, Sizer>::contains(const K &key) const
+{
+    return entries.find(key) != entries.end();
+}
+
+template <typename K, typename V, typename Hash, typename Sizer>
+bool LruCache<K, V, Hash, Sizer>::put(const K &key, V value)
+{
+    std::size_t entryBytes = sizer(key, value);
+    if (entryBytes > byteLimit || entryLimit == 0)
+    {
+        erase(key);
+        return false;
+    }
+
+    typename Map::iterator found = entries.find(key);
+    if (found != entries.end())
+    {
+        Entry &entry = found->second.retrieve();
+        usedBytes = usedBytes - entry.bytes + entryBytes;
+        entry.value = std::move(value);
+        entry.bytes = entryBytes;
+        recency.moveToFront(found->second);
+        while (usedBytes > byteLimit)
+        {
+            evictLeastRecent();
+        }
+        return true;
+    }
+
+    typename Map::node_type spare;
+    while (!recency.isEmpty() && (static_cast<std::size_t>(recency.size()) >= entryLimit || usedBytes + entryBytes > byteLimit))
+    {
+        spare = evictLeastRecent();
+    }
+
+    ListItr<Entry> position = recency.emplaceFront(key, std::move(value), entryBytes);
+    if (spare)
+    {
+        spare.key() = key;
+        spare.mapped() = position;
+        entries.insert(std::move(spare));
+    }
+    else
+    {
+        entries.emplace(key, position);
+    }
+    usedBytes += entryBytes;
+    return true;
+}
+
+template <typename K, typename V, typename Hash, typename Sizer>
+bool LruCache<K, V, Hash, Sizer>::erase(const K &key)
+{
+    typename Map::iterator found = entries.find(key);
+    if (found == entries.end())
+    {
+        return false;
+    }
+
+    usedBytes -= found->second.retrieve().bytes;
+    recency.erase(found->second);
+    entries.erase(found);
+    return true;
+}
+
+template <typename K, typename V, typename Hash, typename Sizer>
+void LruCache<K, V, Hash, Sizer>::clear()
+{
+    entries.clear();
+    recency.makeEmpty();
+    usedBytes = 0;
+}
+
+template <typename K, typename V, typename Hash, typename Sizer>
+std::size_t LruCache<K, V, Hash, Sizer>::size() const
+{
+    return static_cast<std::size_t>(recency.size());
+}
+
+template <typename K, typename V, typename Hash, typename Sizer>
+std::size_t LruCache<K, V, Hash, Sizer>::bytes() const
+{
+    return usedBytes;
+}
+
+template <typename K, typename V, typename Hash, typename Sizer>
+LruCacheStats LruCache<K, V, Hash, Sizer>::stats() const
+{
+    return counters;
+}
+
+template <typename K, typename V, typename Hash, typename Sizer>
+void LruCache<K, V, Hash, Sizer>::resetStats()
+{
+    counters = LruCacheStats{0, 0, 0};
+}
+
+template <typename K, typename V, typename Hash, typename Sizer>
+typename LruCache<K, V, Hash, Sizer>::Map::node_type LruCache<K, V, Hash, Sizer>::evictLeastRecent()
+{
+    ListItr<Entry> victim = recency.last();
+    usedBytes -= victim.retrieve().bytes;
+    typename Map::node_type handle = entries.extract(victim.retrieve().key);
+    recency.erase(victim);
+    counters.evictions++;
+    return handle;
+}
+
+#endif
@@ -0,0 +1,856 @@
+#ifndef MAPPEDLIST_H
+#define MAPPEDLIST_H
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+template <typename T>
+class MappedList;
+
+/**
+ * @class MappedListNode
+ * @brief A node of a MappedList: two links, stored as byte offsets from the start of the file, and a value.
+ *
+ * The dummy head and tail never hold a value. A free node uses `next` to link to the next free node.
+ */
+template <typename T>
+class MappedListNode
+{
+private:
+    std::uint64_t next;     /**< Offset of the next node in the list (or in the free list). */
+    std::uint64_t previous; /**< Offset of the previous node in the list. */
+    T value;                /**< The value of the node. */
+
+    template <typename, bool>
+    friend class MappedListItr; /**< MappedListItr needs access to the value and links. */
+    friend class MappedList<T>; /**< MappedList needs access to the value and links. */
+};
+
+/**
+ * @class MappedListItr
+ * @brief Position in a MappedList: the list plus the file offset of a node.
+ *
+ * Offers both the ListItr vocabulary (moveForward, retrieve, isPastEnd, ...) and the standard
+ * bidirectional iterator operators. Because it stores an offset rather than an address, a position
+ * stays valid when the file grows and the mapping moves; references obtained from it do not.
+ */
+template <typename T, bool IsConst = false>
+class MappedListItr
+{
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::conditional<IsConst, const T *, T *>::type;
+    using reference = typename std::conditional<IsConst, const T &, T &>::type;
+    using ListType = typename std::conditional<IsConst, const MappedList<T>, MappedList<T>>::type;
+
+    /**
+     * @brief Default constructor.
+     *
+     * Constructs a MappedListItr that belongs to no list.
+     */
+    MappedListItr();
+
+    /**
+     * @brief Constructor for a given list and node.
+     *
+     * @param theList The list the position belongs to.
+     * @param theOffset The file offset of the node.
+     */
+    MappedListItr(ListType *theList, std::uint64_t theOffset);
+
+    /**
+     * @brief Converts a mutable position into a read-only one.
+     *
+     * @param other The position to convert.
+     */
+    template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+    MappedListItr(const MappedListItr<T, OtherConst> &other);
+
+    /**
+     * @brief Checks if the iterator is past the end position (on the dummy tail).
+     *
+     * @return True if the iterator is past the end position, false otherwise.
+     */
+    bool isPastEnd() const;
+
+    /**
+     * @brief Checks if the iterator is past the beginning position (on the dummy head).
+     *
+     * @return True if the iterator is past the beginning position, false otherwise.
+     */
+    bool isPastBeginning() const;
+
+    /**
+     * @brief Advances to the next element, unless already past the end.
+     */
+    void moveForward();
+
+    /**
+     * @brief Moves back to the previous element, unless already past the beginning.
+     */
+    void moveBackward();
+
+    /**
+     * @brief Retrieves the value at the current position.
+     *
+     * @return Reference to the value, valid until the file next grows.
+     */
+    reference retrieve() const;
+
+    /** @brief Standard iterator access to the value at the current position, without checks. */
+    reference operator*() const;
+    pointer operator->() const;
+
+    /** @brief Standard iterator movement, without bounds checks. */
+    MappedListItr &operator++();
+    MappedListItr operator++(int);
+    MappedListItr &operator--();
+    MappedListItr operator--(int);
+
+    /** @brief Checks whether two iterators point to the same node. */
+    template <bool OtherConst>
+    bool operator==(const MappedListItr<T, OtherConst> &other) const;
+
+    /** @brief Checks whether two iterators point to different nodes. */
+    template <bool OtherConst>
+    bool operator!=(const MappedListItr<T, OtherConst> &other) const;
+
+private:
+    ListType *list;       /**< The list the position belongs to. */
+    std::uint64_t offset; /**< File offset of the node. */
+
+    friend class MappedList<T>;              /**< MappedList needs access to the position. */
+    friend class MappedListItr<T, !IsConst>; /**< Conversions and comparisons need access. */
+};
+
+/**
+ * @class MappedList
+ * @brief Doubly linked list of trivially copyable values that lives entirely inside a memory-mapped file.
+ *
+ * The file starts with a small header followed by the nodes; links are byte offsets from the start of
+ * the file, so the data means the same thing wherever it is mapped. Opening an existing list checks the
+ * header and maps the file, without reading or parsing the nodes: pages fault in as they are visited.
+ * The file doubles in size when it runs out of room, and freed nodes are reused first.
+ * Changes reach the file through the shared mapping; sync() waits until they are on disk. A list that
+ * was being modified when the process died may be inconsistent. The file uses the native byte order and
+ * layout of T, and must not be opened by two MappedLists at once.
+ */
+template <typename T>
+class MappedList
+{
+    static_assert(std::is_trivially_copyable<T>::value, "MappedList needs a trivially copyable element type.");
+
+public:
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = MappedListItr<T>;
+    using const_iterator = MappedListItr<T, true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /**
+     * @brief Opens the list stored in a file, creating an empty one if the file does not exist or is empty.
+     *
+     * @param path The file holding the list.
+     * @throws std::system_error If the file cannot be opened, resized or mapped.
+     * @throws std::runtime_error If the file holds something other than a list of this element type.
+     */
+    explicit MappedList(const std::string &path);
+
+    /**
+     * @brief Destructor.
+     *
+     * Unmaps and closes the file. The data stays in the file; call sync() first to wait for it to reach the disk.
+     */
+    ~MappedList();
+
+    MappedList(const MappedList &) = delete;
+    MappedList &operator=(const MappedList &) = delete;
+
+    /**
+     * @brief Checks if the list is empty.
+     *
+     * @return True if the list is empty, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Removes all elements in O(1). The file keeps its size.
+     */
+    void makeEmpty();
+
+    /**
+     * @brief Returns an iterator to the first element (past the end if the list is empty).
+     *
+     * @return MappedListItr pointing to the first element.
+     */
+    iterator first();
+
+    /**
+     * @brief Returns an iterator to the last element (past the beginning if the list is empty).
+     *
+     * @return MappedListItr pointing to the last element.
+     */
+    iterator last();
+
+    /**
+     * @brief Inserts a value after the given position.
+     *
+     * @param x The value to be inserted.
+     * @param position The position to insert after.
+     */
+    void insertAfter(const T &x, iterator position);
+
+    /**
+     * @brief Inserts a value before the given position.
+     *
+     * @param x The value to be inserted.
+     * @param position The position to insert before.
+     */
+    void insertBefore(const T &x, iterator position);
+
+    /**
+     * @brief Inserts a value at the tail of the list.
+     *
+     * @param x The value to be inserted.
+     */
+    void insertAtTail(const T &x);
+
+    /**
+     * @brief Inserts a value at the front of the list.
+     *
+     * @param x The value to be inserted.
+     */
+    void insertAtFront(const T &x);
+
+    /**
+     * @brief Returns an iterator to the first occurrence of a value, or past the end if it is not found.
+     *
+     * @param x The value to search for.
+     * @return MappedListItr pointing to the first occurrence of the value.
+     */
+    iterator find(const T &x);
+
+    /**
+     * @brief Removes the first occurrence of a value from the list.
+     *
+     * @param x The value to be removed.
+     */
+    void remove(const T &x);
+
+    /**
+     * @brief Removes the element at the given position and puts its node on the free list.
+     *
+     * @param position The position of the element to be removed.
+     * @return MappedListItr pointing to the element that followed the removed one.
+     */
+    iterator erase(iterator position);
+
+    /**
+     * @brief Returns the number of elements in the list.
+     *
+     * @return The number of elements in the list.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Returns the current size of the file.
+     *
+     * @return The file size in bytes.
+     */
+    std::size_t fileBytes() const;
+
+    /**
+     * @brief Grows the file so that it holds at least `elements` elements without growing again.
+     *
+     * @param elements The number of elements to make room for.
+     */
+    void reserve(std::size_t elements);
+
+    /**
+     * @brief Writes every modified page of the file to disk and waits for the writes to finish.
+     *
+     * @throws std::system_error If the kernel reports a write error.
+     */
+    void sync();
+
+    /**
+     * @brief Prints the contents of the list forwards (head -> tail) or backwards (tail -> head).
+     *
+     * @param os The output stream to which the list is printed.
+     * @param forward True to print forwards, false to print backwards.
+     */
+    void print(std::ostream &os = std::cout, bool forward = true);
+
+    /** @brief Standard iterator access, as on List; end() is the dummy tail. */
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+    reverse_iterator rbegin();
+    reverse_iterator rend();
+
+private:
+    using Node = MappedListNode<T>;
+
+    /**
+     * @brief The first bytes of the file.
+     */
+    struct Header
+    {
+        char magic[8];             // "DLLMAP" followed by two zero bytes
+        std::uint32_t version;     // Layout version
+        std::uint32_t elementSize; // sizeof(T) of the list that created the file
+        std::uint64_t nodeSize;    // sizeof(Node) of the list that created the file
+        std::uint64_t used;        // Offset one past the last node ever handed out
+        std::uint64_t freeNodes;   // Offset of the first free node, or noNode
+        std::uint64_t count;       // Number of elements in the list
+    };
+
+    static constexpr std::uint32_t layoutVersion = 1;
+    static constexpr std::uint64_t headOffset = (sizeof(Header) + alignof(Node) - 1) / alignof(Node) * alignof(Node);
+    static constexpr std::uint64_t tailOffset = headOffset + sizeof(Node);
+    static constexpr std::uint64_t noNode = 0; // End of the free list (offset 0 is the header)
+
+    /**
+     * @brief Returns the node at a file offset.
+     *
+     * @param offset The offset of the node.
+     * @return Pointer to the node inside the mapping.
+     */
+    Node *nodeAt(std::uint64_t offset) const;
+
+    /**
+     * @brief Returns the header at the start of the mapping.
+     *
+     * @return Pointer to the header.
+     */
+    Header *header() const;
+
+    /**
+     * @brief Takes a node from the free list, or the next unused node, growing the file if needed.
+     *
+     * @return The offset of an unlinked node.
+     */
+    std::uint64_t allocateNode();
+
+    /**
+     * @brief Copies `x` into a new node and links it between two adjacent nodes.
+     *
+     * @param x The value to be inserted.
+     * @param before The node that will precede the new one.
+     * @param after The node that will follow the new one.
+     */
+    void insertBetween(const T &x, std::uint64_t before, std::uint64_t after);
+
+    /**
+     * @brief Extends the file and the mapping to `bytes`. Offsets stay valid; addresses may change.
+     *
+     * @param bytes The new file size; more than fileBytes().
+     */
+    void growTo(std::uint64_t bytes);
+
+    /**
+     * @brief Writes an empty list into a freshly sized file.
+     */
+    void initialize();
+
+    int descriptor;          // The open file
+    unsigned char *base;     // Start of the mapping
+    std::uint64_t mapped;    // Size of the file and of the mapping
+    std::string filePath;    // Path the list was opened from, for error messages
+
+    template <typename, bool>
+    friend class MappedListItr; /**< MappedListItr follows links through the mapping. */
+};
+
+template <typename T, bool IsConst>
+MappedListItr<T, IsConst>::MappedListItr()
+{
+    list = nullptr;
+    offset = 0;
+}
+
+template <typename T, bool IsConst>
+MappedListItr<T, IsConst>::MappedListItr(ListType *theList, std::uint64_t theOffset)
+{
+    list = theList;
+    offset = theOffset;
+}
+
+template <typename T, bool IsConst>
+template <bool OtherConst, typename>
+MappedListItr<T, IsConst>::MappedListItr(const MappedListItr<T, OtherConst> &other)
+{
+    list = other.list;
+    offset = other.offset;
+}
+
+template <typename T, bool IsConst>
+bool MappedListItr<T, IsConst>::isPastEnd() const
+{
+    return offset == MappedList<T>::tailOffset;
+}
+
+template <typename T, bool IsConst>
+bool MappedListItr<T, IsConst>::isPastBeginning() const
+{
+    return offset == MappedList<T>::headOffset;
+}
+
+template <typename T, bool IsConst>
+void MappedListItr<T, IsConst>::moveForward()
+{
+    if (list != nullptr && !isPastEnd())
+    {
+        offset = list->nodeAt(offset)->next;
+    }
+}
+
+template <typename T, bool IsConst>
+void MappedListItr<T, IsConst>::moveBackward()
+{
+    if (list != nullptr && !isPastBeginning())
+    {
+        offset = list->nodeAt(offset)->previous;
+    }
+}
+
+template <typename T, bool IsConst>
+typename MappedListItr<T, IsConst>::reference MappedListItr<T, IsConst>::retrieve() const
+{
+    if (list == nullptr || isPastEnd() || isPastBeginning())
+    {
+        throw std::runtime_error("Attempt to retrieve from a position without an element");
+    }
+    return list->nodeAt(offset)->value;
+}
+
+template <typename T, bool IsConst>
+typename MappedListItr<T, IsConst>::reference MappedListItr<T, IsConst>::operator*() const
+{
+    return list->nodeAt(offset)->value;
+}
+
+template <typename T, bool IsConst>
+typename MappedListItr<T, IsConst>::pointer MappedListItr<T, IsConst>::operator->() const
+{
+    return &list->nodeAt(offset)->value;
+}
+
+template <typename T, bool IsConst>
+MappedListItr<T, IsConst> &MappedListItr<T, IsConst>::operator++()
+{
+    offset = list->nodeAt(offset)->next;
+    return *this;
+}
+
+template <typename T, bool IsConst>
+MappedListItr<T, IsConst> MappedListItr<T, IsConst>::operator++(int)
+{
+    MappedListItr<T, IsConst> old = *this;
+    offset = list->nodeAt(offset)->next;
+    return old;
+}
+
+template <typename T, bool IsConst>
+MappedListItr<T, IsConst> &MappedListItr<T, IsConst>::operator--()
+{
+    offset = list->nodeAt(offset)->previous;
+    return *this;
+}
+
+template <typename T, bool IsConst>
+MappedListItr<T, IsConst> MappedListItr<T, IsConst>::operator--(int)
+{
+    MappedListItr<T, IsConst> old = *this;
+    offset = list->nodeAt(offset)->previous;
+    return old;
+}
+
+template <typename T, bool IsConst>
+template <bool OtherConst>
+bool MappedListItr<T, IsConst>::operator==(const MappedListItr<T, OtherConst> &other) const
+{
+    return list == other.list && offset == other.offset;
+}
+
+template <typename T, bool IsConst>
+template <bool OtherConst>
+bool MappedListItr<T, IsConst>::operator!=(const MappedListItr<T, OtherConst> &other) const
+{
+    return !(*this == other);
+}
+
+template <typename T>
+MappedList<T>::MappedList(const std::string &path) : filePath(path)
+{
+    descriptor = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (descriptor < 0)
+    {
+        throw std::system_error(errno, std::generic_category(), "Cannot open " + path);
+    }
+
+    struct stat status;
+    if (::fstat(descriptor, &status) != 0)
+    {
+        int error = errno;
+        ::close(descriptor);
+        throw std::system_error(error, std::generic_category(), "Cannot inspect " + path);
+    }
+
+    bool fresh = status.st_size == 0;
+    if (fresh)
+    {
+        mapped = static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+        while (mapped < tailOffset + 16 * sizeof(Node))
+        {
+            mapped *= 2;
+        }
+        if (::ftruncate(descriptor, static_cast<off_t>(mapped)) != 0)
+        {
+            int error = errno;
+            ::close(descriptor);
+            throw std::system_error(error, std::generic_category(), "Cannot resize " + path);
+        }
+    }
+    else
+    {
+        mapped = static_cast<std::uint64_t>(status.st_size);
+        if (mapped < tailOffset + sizeof(Node))
+        {
+            ::close(descriptor);
+            throw std::runtime_error(path + " does not hold a MappedList of this element type.");
+        }
+    }
+
+    void *address = ::mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    if (address == MAP_FAILED)
+    {
+        int error = errno;
+        ::close(descriptor);
+        throw std::system_error(error, std::generic_category(), "Cannot map " + path);
+    }
+    base = static_cast<unsigned char *>(address);
+
+    if (fresh)
+    {
+        initialize();
+        return;
+    }
+
+    const Header *existing = header();
+    if (std::memcmp(existing->magic, "DLLMAP\0\0", 8) != 0 || existing->version != layoutVersion ||
+        existing->elementSize != sizeof(T) || existing->nodeSize != sizeof(Node) || existing->used > mapped)
+    {
+        ::munmap(base, mapped);
+        ::close(descriptor);
+        throw std::runtime_error(path + " does not hold a MappedList of this element type.");
+    }
+}
+
+template <typename T>
+MappedList<T>::~MappedList()
+{
+    ::munmap(base, mapped);
+    ::close(descriptor);
+}
+
+template <typename T>
+bool MappedList<T>::isEmpty() const
+{
+    return header()->count == 0;
+}
+
+template <typename T>
+void MappedList<T>::makeEmpty()
+{
+    Header *h = header();
+    nodeAt(headOffset)->next = tailOffset;
+    nodeAt(tailOffset)->previous = headOffset;
+    h->used = tailOffset + sizeof(Node);
+    h->freeNodes = noNode;
+    h->count = 0;
+}
+
+template <typename T>
+typename MappedList<T>::iterator MappedList<T>::first()
+{
+    return iterator(this, nodeAt(headOffset)->next);
+}
+
+template <typename T>
+typename MappedList<T>::iterator MappedList<T>::last()
+{
+    return iterator(this, nodeAt(tailOffset)->previous);
+}
+
+template <typename T>
+void MappedList<T>::insertAfter(const T &x, iterator position)
+{
+    if (position.isPastEnd())
+    {
+        throw std::invalid_argument("Cannot insert after the end of the list.");
+    }
+    insertBetween(x, position.offset, nodeAt(position.offset)->next);
+}
+
+template <typename T>
+void MappedList<T>::insertBefore(const T &x, iterator position)
+{
+    if (position.isPastBeginning())
+    {
+        throw std::invalid_argument("Cannot insert before the beginning of the list.");
+    }
+    insertBetween(x, nodeAt(position.offset)->previous, position.offset);
+}
+
+template <typename T>
+void MappedList<T>::insertAtTail(const T &x)
+{
+    insertBetween(x, nodeAt(tailOffset)->previous, tailOffset);
+}
+
+template <typename T>
+void MappedList<T>::insertAtFront(const T &x)
+{
+    insertBetween(x, headOffset, nodeAt(headOffset)->next);
+}
+
+template <typename T>
+typename MappedList<T>::iterator MappedList<T>::find(const T &x)
+{
+    std::uint64_t offset = nodeAt(headOffset)->next;
+    while (offset != tailOffset && nodeAt(offset)->value != x)
+    {
+        offset = nodeAt(offset)->next;
+    }
+    return iterator(this, offset);
+}
+
+template <typename T>
+void MappedList<T>::remove(const T &x)
+{
+    iterator itr = find(x);
+    if (!itr.isPastEnd())
+    {
+        erase(itr);
+    }
+}
+
+template <typename T>
+typename MappedList<T>::iterator MappedList<T>::erase(iterator position)
+{
+    if (position.isPastEnd() || position.isPastBeginning())
+    {
+        throw std::invalid_argument("Cannot erase a dummy head or tail node.");
+    }
+
+    Header *h = header();
+    Node *node = nodeAt(position.offset);
+    std::uint64_t next = node->next;
+    nodeAt(node->previous)->next = next;
+    nodeAt(next)->previous = node->previous;
+    node->next = h->freeNodes;
+    h->freeNodes = position.offset;
+    h->count--;
+    return iterator(this, next);
+}
+
+template <typename T>
+std::size_t MappedList<T>::size() const
+{
+    return static_cast<std::size_t>(header()->count);
+}
+
+template <typename T>
+std::size_t MappedList<T>::fileBytes() const
+{
+    return static_cast<std::size_t>(mapped);
+}
+
+template <typename T>
+void MappedList<T>::reserve(std::size_t elements)
+{
+    std::uint64_t needed = header()->used + static_cast<std::uint64_t>(elements) * sizeof(Node);
+    if (needed > mapped)
+    {
+        growTo(needed);
+    }
+}
+
+template <typename T>
+void MappedList<T>::sync()
+{
+    if (::msync(base, mapped, MS_SYNC) != 0)
+    {
+        throw std::system_error(errno, std::generic_category(), "Cannot sync " + filePath);
+    }
+}
+
+template <typename T>
+void MappedList<T>::print(std::ostream &os, bool forward)
+{
+    if (forward)
+    {
+        for (iterator itr = first(); !itr.isPastEnd(); itr.moveForward())
+        {
+            os << itr.retrieve() << " ";
+        }
+    }
+    else
+    {
+        for (iterator itr = last(); !itr.isPastBeginning(); itr.moveBackward())
+        {
+            os << itr.retrieve() << " ";
+        }
+    }
+    os << std::endl;
+}
+
+template <typename T>
+typename MappedList<T>::iterator MappedList<T>::begin()
+{
+    return first();
+}
+
+template <typename T>
+typename MappedList<T>::iterator MappedList<T>::end()
+{
+    return iterator(this, tailOffset);
+}
+
+template <typename T>
+typename MappedList<T>::const_iterator MappedList<T>::begin() const
+{
+    return const_iterator(this, nodeAt(headOffset)->next);
+}
+
+template <typename T>
+typename MappedList<T>::const_iterator MappedList<T>::end() const
+{
+    return const_iterator(this, tailOffset);
+}
+
+template <typename T>
+typename MappedList<T>::reverse_iterator MappedList<T>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <typename T>
+typename MappedList<T>::reverse_iterator MappedList<T>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template <typename T>
+typename MappedList<T>::Node *MappedList<T>::nodeAt(std::uint64_t offset) const
+{
+    return reinterpret_cast<Node *>(base + offset);
+}
+
+template <typename T>
+typename MappedList<T>::Header *MappedList<T>::header() const
+{
+    return reinterpret_cast<Header *>(base);
+}
+
+template <typename T>
+std::uint64_t MappedList<T>::allocateNode()
+{
+    Header *h = header();
+    if (h->freeNodes != noNode)
+    {
+        std::uint64_t offset = h->freeNodes;
+        h->freeNodes = nodeAt(offset)->next;
+        return offset;
+    }
+    if (h->used + sizeof(Node) > mapped)
+    {
+        growTo(mapped * 2);
+        h = header();
+    }
+    std::uint64_t offset = h->used;
+    h->used += sizeof(Node);
+    return offset;
+}
+
+template <typename T>
+void MappedList<T>::insertBetween(const T &x, std::uint64_t before, std::uint64_t after)
+{
+    // Copy first: `x` may live in the mapping, which allocateNode() can move
+    alignas(T) unsigned char copy[sizeof(T)];
+    std::memcpy(copy, static_cast<const void *>(&x), sizeof(T));
+    std::uint64_t offset = allocateNode();
+
+    Node *node = nodeAt(offset);
+    std::memcpy(static_cast<void *>(&node->value), copy, sizeof(T));
+    node->previous = before;
+    node->next = after;
+    nodeAt(before)->next = offset;
+    nodeAt(after)->previous = offset;
+    header()->count++;
+}
+
+template <typename T>
+void MappedList<T>::growTo(std::uint64_t bytes)
+{
+    if (::ftruncate(descriptor, static_cast<off_t>(bytes)) != 0)
+    {
+        throw std::system_error(errno, std::generic_category(), "Cannot grow " + filePath);
+    }
+
+#ifdef __linux__
+    void *address = ::mremap(base, mapped, bytes, MREMAP_MAYMOVE);
+    if (address == MAP_FAILED)
+    {
+        throw std::system_error(errno, std::generic_category(), "Cannot remap " + filePath);
+    }
+#else
+    void *address = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    if (address == MAP_FAILED)
+    {
+        throw std::system_error(errno, std::generic_category(), "Cannot remap " + filePath);
+    }
+    ::munmap(base, mapped);
+#endif
+    base = static_cast<unsigned char *>(address);
+    mapped = bytes;
+}
+
+template <typename T>
+void MappedList<T>::initialize()
+{
+    Header *h = header();
+    std::memcpy(h->magic, "DLLMAP\0\0", 8);
+    h->version = layoutVersion;
+    h->elementSize = sizeof(T);
+    h->nodeSize = sizeof(Node);
+
+    Node *head = nodeAt(headOffset);
+    Node *tail = nodeAt(tailOffset);
+    head->previous = headOffset;
+    tail->next = tailOffset;
+    makeEmpty();
+}
+
+#endif
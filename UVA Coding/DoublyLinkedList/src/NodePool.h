@@ -0,0 +1,350 @@
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @class NodePool
+ * @brief Slab allocator that hands out fixed-size node storage from large contiguous blocks.
+ *
+ * Storage is carved sequentially out of blocks of `nodesPerBlock` slots, so nodes allocated one
+ * after another (for example by repeated insertAtTail) sit next to each other in memory. Freed
+ * slots are kept on an intrusive free list and reused before a new block is requested.
+ * The pool only manages raw storage: callers construct and destroy the Node objects themselves.
+ * A pool may be shared by several lists, but it must outlive every list that uses it.
+ */
+template <typename Node>
+class NodePool
+{
+    union Slot;
+
+public:
+    /**
+     * @class FreeBatch
+     * @brief Storage collected by a sweep and handed back to the pool in one step.
+     *
+     * Adding a node only writes into its own slot, so the pool's free list and counters are touched once
+     * per batch instead of once per node.
+     */
+    class FreeBatch
+    {
+    public:
+        FreeBatch() : first(nullptr), last(nullptr), size(0) {}
+
+        /**
+         * @brief Adds storage obtained from the pool to the batch.
+         *
+         * The Node must already have been destroyed.
+         * @param node The storage to release.
+         */
+        void add(Node *node);
+
+    private:
+        Slot *first;      // Most recently added slot
+        Slot *last;       // First added slot; links to the rest of the free list once released
+        std::size_t size; // Number of slots in the batch
+
+        friend class NodePool;
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * No memory is requested until the first allocation.
+     * @param nodesPerBlock The number of node slots carved out of each block.
+     */
+    explicit NodePool(std::size_t nodesPerBlock = 1024);
+
+    /**
+     * @brief Destructor.
+     *
+     * Releases every block. Any node still handed out becomes dangling.
+     */
+    ~NodePool();
+
+    NodePool(const NodePool &) = delete;
+    NodePool &operator=(const NodePool &) = delete;
+
+    /**
+     * @brief Returns uninitialized storage for one Node.
+     *
+     * Reuses the most recently freed slot if there is one, otherwise takes the next slot of the current block.
+     * @return Pointer to storage suitable for placement-new of a Node.
+     */
+    Node *allocate();
+
+    /**
+     * @brief Returns storage obtained from allocate() to the free list.
+     *
+     * The Node must already have been destroyed.
+     * @param node The storage to release.
+     */
+    void deallocate(Node *node);
+
+    /**
+     * @brief Returns every slot of a batch to the free list and empties the batch.
+     *
+     * @param batch The storage to release.
+     */
+    void deallocate(FreeBatch &batch);
+
+    /**
+     * @brief Makes sure the next `n` calls to allocateFresh() are served from one contiguous run of slots.
+     *
+     * If the current block has fewer than `n` unused slots, they are moved to the free list and a new block
+     * of at least `n` slots becomes current.
+     * @param n The number of slots needed in a row.
+     */
+    void reserveContiguous(std::size_t n);
+
+    /**
+     * @brief Returns uninitialized storage for one Node from the current block, bypassing the free list.
+     *
+     * Successive calls hand out adjacent slots, which is how bulk builds keep their nodes in address order.
+     * @return Pointer to storage suitable for placement-new of a Node.
+     */
+    Node *allocateFresh();
+
+    /**
+     * @brief Takes back every slot at once, keeping the blocks for reuse.
+     *
+     * Runs in time proportional to the number of blocks, not of nodes. Only valid when none of the nodes
+     * handed out is still in use; they are not destroyed, so this is meant for trivially destructible Nodes
+     * or Nodes the caller has already destroyed.
+     */
+    void reset();
+
+    /**
+     * @brief Returns the number of slots currently handed out.
+     *
+     * @return The number of live nodes.
+     */
+    std::size_t liveNodes() const;
+
+    /**
+     * @brief Returns the number of blocks requested from the system so far.
+     *
+     * @return The number of blocks.
+     */
+    std::size_t blockCount() const;
+
+    /**
+     * @brief Returns the number of slots per block.
+     *
+     * @return The block size in nodes.
+     */
+    std::size_t nodesPerBlock() const;
+
+private:
+    union Slot
+    {
+        Slot *nextFree;                               // Link used while the slot is on the free list
+        alignas(Node) unsigned char storage[sizeof(Node)]; // Node storage while the slot is in use
+    };
+
+    struct Block
+    {
+        Slot *slots;      // First slot of the block
+        std::size_t size; // Number of slots in the block
+    };
+
+    /**
+     * @brief Makes the next block with at least `slots` slots current.
+     *
+     * Blocks left behind by reset() are reused before a new one is requested; a reused block that is too
+     * small goes to the free list instead.
+     * @param slots The number of slots needed in a row.
+     */
+    void nextBlock(std::size_t slots);
+
+    /**
+     * @brief Moves the unused slots of the current block to the free list.
+     */
+    void releaseBumpRegion();
+
+    std::vector<Block> blocks; // Every block requested so far
+    std::size_t currentBlock;  // Index in `blocks` of the block the bump cursor points into
+    Slot *freeList;            // Most recently freed slot
+    Slot *bumpCursor;          // Next never-used slot of the current block
+    Slot *bumpEnd;             // One past the last slot of the current block
+    std::size_t blockSize;     // Number of slots per block
+    std::size_t live;          // Number of slots handed out
+};
+
+template <typename Node>
+NodePool<Node>::NodePool(std::size_t nodesPerBlock)
+{
+    if (nodesPerBlock == 0)
+    {
+        throw std::invalid_argument("A node pool needs at least one node per block.");
+    }
+
+    currentBlock = 0;
+    freeList = nullptr;
+    bumpCursor = nullptr;
+    bumpEnd = nullptr;
+    blockSize = nodesPerBlock;
+    live = 0;
+}
+
+template <typename Node>
+NodePool<Node>::~NodePool()
+{
+    for (const Block &block : blocks)
+    {
+        ::operator delete(block.slots);
+    }
+}
+
+template <typename Node>
+Node *NodePool<Node>::allocate()
+{
+    Slot *slot;
+    if (freeList != nullptr)
+    {
+        slot = freeList;
+        freeList = slot->nextFree;
+    }
+    else
+    {
+        if (bumpCursor == bumpEnd)
+        {
+            nextBlock(1);
+        }
+        slot = bumpCursor++;
+    }
+    live++;
+    return reinterpret_cast<Node *>(slot->storage);
+}
+
+template <typename Node>
+void NodePool<Node>::reserveContiguous(std::size_t n)
+{
+    if (static_cast<std::size_t>(bumpEnd - bumpCursor) >= n)
+    {
+        return;
+    }
+
+    // Keep the tail of the current block usable by allocate() instead of stranding it
+    releaseBumpRegion();
+    nextBlock(n);
+}
+
+template <typename Node>
+Node *NodePool<Node>::allocateFresh()
+{
+    if (bumpCursor == bumpEnd)
+    {
+        nextBlock(1);
+    }
+    live++;
+    return reinterpret_cast<Node *>((bumpCursor++)->storage);
+}
+
+template <typename Node>
+void NodePool<Node>::deallocate(Node *node)
+{
+    Slot *slot = reinterpret_cast<Slot *>(node);
+    slot->nextFree = freeList;
+    freeList = slot;
+    live--;
+}
+
+template <typename Node>
+void NodePool<Node>::deallocate(FreeBatch &batch)
+{
+    if (batch.size == 0)
+    {
+        return;
+    }
+
+    batch.last->nextFree = freeList;
+    freeList = batch.first;
+    live -= batch.size;
+    batch = FreeBatch();
+}
+
+template <typename Node>
+void NodePool<Node>::FreeBatch::add(Node *node)
+{
+    Slot *slot = reinterpret_cast<Slot *>(node);
+    slot->nextFree = first;
+    first = slot;
+    if (last == nullptr)
+    {
+        last = slot;
+    }
+    size++;
+}
+
+template <typename Node>
+void NodePool<Node>::reset()
+{
+    freeList = nullptr;
+    live = 0;
+    currentBlock = 0;
+    if (blocks.empty())
+    {
+        return;
+    }
+    bumpCursor = blocks[0].slots;
+    bumpEnd = blocks[0].slots + blocks[0].size;
+}
+
+template <typename Node>
+std::size_t NodePool<Node>::liveNodes() const
+{
+    return live;
+}
+
+template <typename Node>
+std::size_t NodePool<Node>::blockCount() const
+{
+    return blocks.size();
+}
+
+template <typename Node>
+std::size_t NodePool<Node>::nodesPerBlock() const
+{
+    return blockSize;
+}
+
+template <typename Node>
+void NodePool<Node>::nextBlock(std::size_t slots)
+{
+    while (currentBlock + 1 < blocks.size())
+    {
+        currentBlock++;
+        bumpCursor = blocks[currentBlock].slots;
+        bumpEnd = bumpCursor + blocks[currentBlock].size;
+        if (blocks[currentBlock].size >= slots)
+        {
+            return;
+        }
+        releaseBumpRegion();
+    }
+
+    std::size_t size = slots > blockSize ? slots : blockSize;
+    blocks.reserve(blocks.size() + 1);
+    Slot *block = static_cast<Slot *>(::operator new(size * sizeof(Slot)));
+    blocks.push_back(Block{block, size});
+    currentBlock = blocks.size() - 1;
+    bumpCursor = block;
+    bumpEnd = block + size;
+}
+
+template <typename Node>
+void NodePool<Node>::releaseBumpRegion()
+{
+    while (bumpCursor != bumpEnd)
+    {
+        bumpCursor->nextFree = freeList;
+        freeList = bumpCursor;
+        bumpCursor++;
+    }
+}
+
+#endif
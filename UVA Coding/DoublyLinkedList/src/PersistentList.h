@@ -0,0 +1,755 @@
+#ifndef PERSISTENTLIST_H
+#define PERSISTENTLIST_H
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+template <typename T>
+class PersistentList;
+
+template <typename T>
+class PersistentListItr;
+
+/**
+ * @class PersistentListNode
+ * @brief An immutable node of a PersistentList, shared by every version that contains it.
+ *
+ * The value and the next link never change once the node is published, so any number of threads can read it.
+ * Only the reference count is written after construction, and it is atomic.
+ */
+template <typename T>
+class PersistentListNode
+{
+public:
+    /**
+     * @brief Constructs the value from `args` in front of `theNext`.
+     *
+     * @param theNext The node that follows this one; the new node takes over one reference to it.
+     * @param args The arguments forwarded to the constructor of T.
+     */
+    template <typename... Args>
+    explicit PersistentListNode(const PersistentListNode *theNext, Args &&...args);
+
+private:
+    T value;                                      /**< Holds the value. */
+    const PersistentListNode *next;               /**< The following node, or nullptr at the end of the list. */
+    mutable std::atomic<std::size_t> references;  /**< Number of versions and nodes pointing to this node. */
+
+    friend class PersistentListItr<T>; /**< PersistentListItr needs to follow links and read the value. */
+    friend class PersistentList<T>;    /**< PersistentList needs to link and count references. */
+};
+
+/**
+ * @class PersistentListItr
+ * @brief Read-only position in one version of a PersistentList.
+ *
+ * The PersistentListItr offers the ListItr vocabulary (moveForward, retrieve, isPastEnd) and the standard
+ * forward iterator operators. Nodes are singly linked so that a suffix can be shared between versions,
+ * so there is no moveBackward. A position stays valid as long as some version containing its node is alive,
+ * and it can be passed to any version that shares that node.
+ */
+template <typename T>
+class PersistentListItr
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = const T &;
+
+    /**
+     * @brief Default constructor.
+     *
+     * Constructs a PersistentListItr past the end of every list.
+     */
+    PersistentListItr();
+
+    /**
+     * @brief Constructor for a position at a node.
+     *
+     * @param theNode The node at the position, or nullptr for past the end.
+     */
+    explicit PersistentListItr(const PersistentListNode<T> *theNode);
+
+    /**
+     * @brief Checks if the iterator is past the end position.
+     *
+     * @return True if the iterator is past the end position, false otherwise.
+     */
+    bool isPastEnd() const;
+
+    /**
+     * @brief Advances the iterator to the next position, unless it is already past the end.
+     */
+    void moveForward();
+
+    /**
+     * @brief Retrieves the value at the current position.
+     *
+     * @return Reference to the value at the current position.
+     * @throws std::runtime_error if the iterator is past the end.
+     */
+    const T &retrieve() const;
+
+    /**
+     * @brief Checks whether two iterators point to the same position.
+     *
+     * @param rhs The iterator to compare with.
+     * @return True if both iterators are at the same node.
+     */
+    bool operator==(const PersistentListItr &rhs) const;
+
+    /**
+     * @brief Checks whether two iterators point to different positions.
+     *
+     * @param rhs The iterator to compare with.
+     * @return True if the iterators are at different nodes.
+     */
+    bool operator!=(const PersistentListItr &rhs) const;
+
+    /**
+     * @brief Returns the value at the current position.
+     */
+    reference operator*() const;
+
+    /**
+     * @brief Returns a pointer to the value at the current position.
+     */
+    pointer operator->() const;
+
+    /**
+     * @brief Advances to the next position.
+     *
+     * @return This iterator.
+     */
+    PersistentListItr &operator++();
+
+    /**
+     * @brief Advances to the next position.
+     *
+     * @return The position before advancing.
+     */
+    PersistentListItr operator++(int);
+
+private:
+    const PersistentListNode<T> *current; /**< The node at the position, or nullptr past the end. */
+
+    friend class PersistentList<T>; /**< PersistentList needs the node of a position. */
+};
+
+/**
+ * @class PersistentList
+ * @brief An immutable, versioned singly linked list whose versions share their unchanged nodes.
+ *
+ * Every modifying operation leaves the list it is called on untouched and returns a new version.
+ * The new version shares every node after the change with the old one and copies only the nodes in front of it,
+ * so insertAtFront and removeFirst are O(1), an edit at position k costs k copies, and insertAtTail copies the list.
+ * Copying a version is O(1) and allocates nothing.
+ *
+ * Nodes are reference counted with atomic counts and freed when the last version holding them goes away,
+ * so versions can be read, copied and edited from several threads without locks. As with std::shared_ptr,
+ * one PersistentList object must not be assigned to while another thread reads that same object.
+ */
+template <typename T>
+class PersistentList
+{
+public:
+    using const_iterator = PersistentListItr<T>;
+    using iterator = const_iterator;
+
+    /**
+     * @brief Default constructor.
+     *
+     * Constructs an empty list.
+     */
+    PersistentList();
+
+    /**
+     * @brief Constructs a list holding the values in [first, last), in order.
+     *
+     * @param first The beginning of the range.
+     * @param last The end of the range.
+     */
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    PersistentList(InputIt first, InputIt last);
+
+    /**
+     * @brief Constructs a list holding the given values, in order.
+     *
+     * @param values The values.
+     */
+    PersistentList(std::initializer_list<T> values);
+
+    /**
+     * @brief Copy constructor; shares every node of `source`.
+     *
+     * @param source The version to share.
+     */
+    PersistentList(const PersistentList &source);
+
+    /**
+     * @brief Move constructor; takes over the nodes of `source` and leaves it empty.
+     *
+     * @param source The version to take over.
+     */
+    PersistentList(PersistentList &&source) noexcept;
+
+    /**
+     * @brief Destructor; releases this version's reference to its nodes.
+     */
+    ~PersistentList();
+
+    /**
+     * @brief Copy assignment operator; shares every node of `source`.
+     *
+     * @param source The version to share.
+     * @return This list.
+     */
+    PersistentList &operator=(const PersistentList &source);
+
+    /**
+     * @brief Move assignment operator; takes over the nodes of `source` and leaves it empty.
+     *
+     * @param source The version to take over.
+     * @return This list.
+     */
+    PersistentList &operator=(PersistentList &&source) noexcept;
+
+    /**
+     * @brief Checks if the list is empty.
+     *
+     * @return True if the list is empty, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Returns the number of elements in the list.
+     *
+     * @return The number of elements.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Returns the position of the first element, or past the end if the list is empty.
+     */
+    PersistentListItr<T> first() const;
+
+    /**
+     * @brief Returns the position of the last element, or past the end if the list is empty.
+     */
+    PersistentListItr<T> last() const;
+
+    /**
+     * @brief Finds the first occurrence of `x`.
+     *
+     * @param x The value to find.
+     * @return The position of the first element equal to `x`, or past the end if there is none.
+     */
+    PersistentListItr<T> find(const T &x) const;
+
+    /**
+     * @brief Returns a version with `x` in front of the first element. O(1).
+     *
+     * @param x The value to insert.
+     * @return The new version.
+     */
+    PersistentList insertAtFront(const T &x) const;
+
+    /**
+     * @brief Returns a version with `x` after the last element. Copies every node of this version.
+     *
+     * @param x The value to insert.
+     * @return The new version.
+     */
+    PersistentList insertAtTail(const T &x) const;
+
+    /**
+     * @brief Returns a version with `x` inserted before `position`.
+     *
+     * Copies the nodes in front of `position`; a position past the end inserts at the tail.
+     * @param x The value to insert.
+     * @param position A position in this version.
+     * @return The new version.
+     * @throws std::invalid_argument if `position` is not in this version.
+     */
+    PersistentList insertBefore(const T &x, PersistentListItr<T> position) const;
+
+    /**
+     * @brief Returns a version with `x` inserted after `position`.
+     *
+     * Copies the nodes up to and including `position`.
+     * @param x The value to insert.
+     * @param position A position in this version.
+     * @return The new version.
+     * @throws std::invalid_argument if `position` is past the end or not in this version.
+     */
+    PersistentList insertAfter(const T &x, PersistentListItr<T> position) const;
+
+    /**
+     * @brief Returns a version without the first element. O(1).
+     *
+     * @return The new version.
+     * @throws std::runtime_error if the list is empty.
+     */
+    PersistentList removeFirst() const;
+
+    /**
+     * @brief Returns a version without the first occurrence of `x`.
+     *
+     * Copies the nodes in front of the removed one; if `x` does not occur, the result shares every node with this version.
+     * @param x The value to remove.
+     * @return The new version.
+     */
+    PersistentList remove(const T &x) const;
+
+    /**
+     * @brief Returns a version without the element at `position`.
+     *
+     * Copies the nodes in front of `position`.
+     * @param position A position in this version.
+     * @return The new version.
+     * @throws std::invalid_argument if `position` is past the end or not in this version.
+     */
+    PersistentList erase(PersistentListItr<T> position) const;
+
+    /**
+     * @brief Prints the elements of the list, separated by spaces.
+     *
+     * @param os The output stream.
+     */
+    void print(std::ostream &os = std::cout) const;
+
+    /**
+     * @brief Checks whether two versions share their first node, which makes them the same list.
+     *
+     * @param other The version to compare with.
+     * @return True if both versions start at the same node.
+     */
+    bool sharesNodesWith(const PersistentList &other) const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+private:
+    using Node = PersistentListNode<T>;
+
+    /**
+     * @brief Adopts a chain; the new version takes over one reference to `theHead`.
+     */
+    PersistentList(const Node *theHead, const Node *theLast, std::size_t theCount);
+
+    /**
+     * @brief Adds a reference to `node`, if any, and returns it.
+     */
+    static const Node *acquire(const Node *node);
+
+    /**
+     * @brief Drops a reference to `node` and frees every node of the chain whose count reaches zero.
+     *
+     * Walks the chain iteratively, so releasing a long list does not recurse.
+     */
+    static void release(const Node *node);
+
+    /**
+     * @brief Builds a version that copies the nodes of this version in front of `stop` and continues with `suffix`.
+     *
+     * @param stop The first node not to copy; nullptr copies every node.
+     * @param suffix The chain after the copies; the new version takes over one reference to it, even on a throw.
+     * @param newCount The number of elements of the new version.
+     * @return The new version.
+     * @throws std::invalid_argument if `stop` is not in this version.
+     */
+    PersistentList copyPrefix(const Node *stop, const Node *suffix, std::size_t newCount) const;
+
+    const Node *head;  /**< The first node, or nullptr if the list is empty. */
+    const Node *tail;  /**< The last node, or nullptr if the list is empty. */
+    std::size_t count; /**< Number of elements in this version. */
+};
+
+template <typename T>
+template <typename... Args>
+PersistentListNode<T>::PersistentListNode(const PersistentListNode *theNext, Args &&...args)
+    : value(std::forward<Args>(args)...), next(theNext), references(1)
+{
+}
+
+template <typename T>
+PersistentListItr<T>::PersistentListItr() : current(nullptr)
+{
+}
+
+template <typename T>
+PersistentListItr<T>::PersistentListItr(const PersistentListNode<T> *theNode) : current(theNode)
+{
+}
+
+template <typename T>
+bool PersistentListItr<T>::isPastEnd() const
+{
+    return current == nullptr;
+}
+
+template <typename T>
+void PersistentListItr<T>::moveForward()
+{
+    if (current != nullptr)
+    {
+        current = current->next;
+    }
+}
+
+template <typename T>
+const T &PersistentListItr<T>::retrieve() const
+{
+    if (current != nullptr)
+    {
+        return current->value;
+    }
+    else
+    {
+        throw std::runtime_error("Attempt to retrieve from a null pointer");
+    }
+}
+
+template <typename T>
+bool PersistentListItr<T>::operator==(const PersistentListItr &rhs) const
+{
+    return current == rhs.current;
+}
+
+template <typename T>
+bool PersistentListItr<T>::operator!=(const PersistentListItr &rhs) const
+{
+    return current != rhs.current;
+}
+
+template <typename T>
+typename PersistentListItr<T>::reference PersistentListItr<T>::operator*() const
+{
+    return current->value;
+}
+
+template <typename T>
+typename PersistentListItr<T>::pointer PersistentListItr<T>::operator->() const
+{
+    return &current->value;
+}
+
+template <typename T>
+PersistentListItr<T> &PersistentListItr<T>::operator++()
+{
+    current = current->next;
+    return *this;
+}
+
+template <typename T>
+PersistentListItr<T> PersistentListItr<T>::operator++(int)
+{
+    PersistentListItr before = *this;
+    current = current->next;
+    return before;
+}
+
+template <typename T>
+PersistentList<T>::PersistentList() : head(nullptr), tail(nullptr), count(0)
+{
+}
+
+template <typename T>
+template <typename InputIt, typename>
+PersistentList<T>::PersistentList(InputIt first, InputIt last) : head(nullptr), tail(nullptr), count(0)
+{
+    // The nodes are private to this constructor until it returns, so they can still be linked in order
+    Node *lastNode = nullptr;
+    try
+    {
+        for (; first != last; ++first)
+        {
+            Node *node = new Node(nullptr, *first);
+            if (lastNode == nullptr)
+            {
+                head = node;
+            }
+            else
+            {
+                lastNode->next = node;
+            }
+            lastNode = node;
+            count++;
+        }
+    }
+    catch (...)
+    {
+        release(head);
+        throw;
+    }
+    tail = lastNode;
+}
+
+template <typename T>
+PersistentList<T>::PersistentList(std::initializer_list<T> values) : PersistentList(values.begin(), values.end())
+{
+}
+
+template <typename T>
+PersistentList<T>::PersistentList(const PersistentList &source)
+    : head(acquire(source.head)), tail(source.tail), count(source.count)
+{
+}
+
+template <typename T>
+PersistentList<T>::PersistentList(PersistentList &&source) noexcept : head(source.head), tail(source.tail), count(source.count)
+{
+    source.head = nullptr;
+    source.tail = nullptr;
+    source.count = 0;
+}
+
+template <typename T>
+PersistentList<T>::PersistentList(const Node *theHead, const Node *theLast, std::size_t theCount)
+    : head(theHead), tail(theLast), count(theCount)
+{
+}
+
+template <typename T>
+PersistentList<T>::~PersistentList()
+{
+    release(head);
+}
+
+template <typename T>
+PersistentList<T> &PersistentList<T>::operator=(const PersistentList &source)
+{
+    // Acquire before releasing, so assigning a version to itself keeps its nodes
+    const Node *newHead = acquire(source.head);
+    release(head);
+    head = newHead;
+    tail = source.tail;
+    count = source.count;
+    return *this;
+}
+
+template <typename T>
+PersistentList<T> &PersistentList<T>::operator=(PersistentList &&source) noexcept
+{
+    if (this != &source)
+    {
+        release(head);
+        head = source.head;
+        tail = source.tail;
+        count = source.count;
+        source.head = nullptr;
+        source.tail = nullptr;
+        source.count = 0;
+    }
+    return *this;
+}
+
+template <typename T>
+bool PersistentList<T>::isEmpty() const
+{
+    return head == nullptr;
+}
+
+template <typename T>
+std::size_t PersistentList<T>::size() const
+{
+    return count;
+}
+
+template <typename T>
+PersistentListItr<T> PersistentList<T>::first() const
+{
+    return PersistentListItr<T>(head);
+}
+
+template <typename T>
+PersistentListItr<T> PersistentList<T>::last() const
+{
+    return PersistentListItr<T>(tail);
+}
+
+template <typename T>
+PersistentListItr<T> PersistentList<T>::find(const T &x) const
+{
+    const Node *node = head;
+    while (node != nullptr && node->value != x)
+    {
+        node = node->next;
+    }
+    return PersistentListItr<T>(node);
+}
+
+template <typename T>
+PersistentList<T> PersistentList<T>::insertAtFront(const T &x) const
+{
+    Node *node = new Node(nullptr, x);
+    node->next = acquire(head);
+    return PersistentList(node, tail != nullptr ? tail : node, count + 1);
+}
+
+template <typename T>
+PersistentList<T> PersistentList<T>::insertAtTail(const T &x) const
+{
+    return copyPrefix(nullptr, new Node(nullptr, x), count + 1);
+}
+
+template <typename T>
+PersistentList<T> PersistentList<T>::insertBefore(const T &x, PersistentListItr<T> position) const
+{
+    Node *node = new Node(nullptr, x);
+    node->next = acquire(position.current);
+    return copyPrefix(position.current, node, count + 1);
+}
+
+template <typename T>
+PersistentList<T> PersistentList<T>::insertAfter(const T &x, PersistentListItr<T> position) const
+{
+    if (position.isPastEnd())
+    {
+        throw std::invalid_argument("Cannot insert after the end of the list.");
+    }
+    PersistentListItr<T> following = position;
+    following.moveForward();
+    return insertBefore(x, following);
+}
+
+template <typename T>
+PersistentList<T> PersistentList<T>::removeFirst() const
+{
+    if (isEmpty())
+    {
+        throw std::runtime_error("Cannot remove from an empty list.");
+    }
+    const Node *rest = acquire(head->next);
+    return PersistentList(rest, rest != nullptr ? tail : nullptr, count - 1);
+}
+
+template <typename T>
+PersistentList<T> PersistentList<T>::remove(const T &x) const
+{
+    PersistentListItr<T> position = find(x);
+    if (position.isPastEnd())
+    {
+        return *this;
+    }
+    return erase(position);
+}
+
+template <typename T>
+PersistentList<T> PersistentList<T>::erase(PersistentListItr<T> position) const
+{
+    if (position.isPastEnd())
+    {
+        throw std::invalid_argument("Cannot erase past the end of the list.");
+    }
+    return copyPrefix(position.current, acquire(position.current->next), count - 1);
+}
+
+template <typename T>
+void PersistentList<T>::print(std::ostream &os) const
+{
+    for (const Node *node = head; node != nullptr; node = node->next)
+    {
+        os << node->value << " ";
+    }
+    os << std::endl;
+}
+
+template <typename T>
+bool PersistentList<T>::sharesNodesWith(const PersistentList &other) const
+{
+    return head == other.head;
+}
+
+template <typename T>
+typename PersistentList<T>::const_iterator PersistentList<T>::begin() const
+{
+    return first();
+}
+
+template <typename T>
+typename PersistentList<T>::const_iterator PersistentList<T>::end() const
+{
+    return const_iterator();
+}
+
+template <typename T>
+const PersistentListNode<T> *PersistentList<T>::acquire(const Node *node)
+{
+    if (node != nullptr)
+    {
+        node->references.fetch_add(1, std::memory_order_relaxed);
+    }
+    return node;
+}
+
+template <typename T>
+void PersistentList<T>::release(const Node *node)
+{
+    // The acquire-release decrement makes every read of a node happen before the thread that frees it
+    while (node != nullptr && node->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        const Node *next = node->next;
+        delete node;
+        node = next;
+    }
+}
+
+template <typename T>
+PersistentList<T> PersistentList<T>::copyPrefix(const Node *stop, const Node *suffix, std::size_t newCount) const
+{
+    const Node *newHead = nullptr;
+    Node *lastCopy = nullptr;
+    try
+    {
+        const Node *node = head;
+        for (; node != stop; node = node->next)
+        {
+            if (node == nullptr)
+            {
+                throw std::invalid_argument("The position is not in this version of the list.");
+            }
+            Node *copy = new Node(nullptr, node->value);
+            if (lastCopy == nullptr)
+            {
+                newHead = copy;
+            }
+            else
+            {
+                lastCopy->next = copy;
+            }
+            lastCopy = copy;
+        }
+    }
+    catch (...)
+    {
+        release(newHead);
+        release(suffix);
+        throw;
+    }
+
+    const Node *newTail = tail;
+    if (suffix == nullptr)
+    {
+        newTail = lastCopy;
+    }
+    else if (stop == nullptr)
+    {
+        newTail = suffix;
+    }
+    if (lastCopy == nullptr)
+    {
+        return PersistentList(suffix, newTail, newCount);
+    }
+    lastCopy->next = suffix;
+    return PersistentList(newHead, newTail, newCount);
+}
+
+#endif
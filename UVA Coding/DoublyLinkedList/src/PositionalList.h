@@ -0,0 +1,988 @@
+#ifndef POSITIONALLIST_H
+#define POSITIONALLIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "Prefetch.h"
+
+template <typename T>
+class PositionalList;
+
+/**
+ * @class PositionalListNode
+ * @brief A node of a PositionalList: the value plus a tower of links, one per skip level.
+ *
+ * Level 0 is the ordinary doubly linked list. A link at level l points to the nearest node in that
+ * direction whose tower reaches level l, and records how many level-0 steps that jump covers.
+ * The tower lives in the same allocation, right after the node. The dummy head and tail hold no value.
+ */
+template <typename T>
+class PositionalListNode
+{
+private:
+    /**
+     * @brief One level of a tower.
+     */
+    struct Link
+    {
+        PositionalListNode *next;     /**< Next node whose tower reaches this level. */
+        PositionalListNode *previous; /**< Previous node whose tower reaches this level. */
+        std::size_t width;            /**< Number of level-0 steps from this node to `next`. */
+    };
+
+    /**
+     * @brief Returns the value stored in the node.
+     *
+     * @return Pointer to the value.
+     */
+    T *value();
+
+    Link *links;                                 /**< The tower, `height` links long. */
+    int height;                                  /**< Number of levels this node takes part in. */
+    alignas(T) unsigned char storage[sizeof(T)]; /**< Storage for the value (unused in the dummy nodes). */
+
+    template <typename, bool>
+    friend class PositionalListItr; /**< PositionalListItr needs access to the value and links. */
+    friend class PositionalList<T>; /**< PositionalList needs access to the value and links. */
+};
+
+/**
+ * @class PositionalListItr
+ * @brief Position in a PositionalList.
+ *
+ * Offers both the ListItr vocabulary (moveForward, retrieve, isPastEnd, ...) and the standard
+ * bidirectional iterator operators. Like a ListItr, it stays valid until its own element is erased.
+ */
+template <typename T, bool IsConst = false>
+class PositionalListItr
+{
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::conditional<IsConst, const T *, T *>::type;
+    using reference = typename std::conditional<IsConst, const T &, T &>::type;
+
+    /**
+     * @brief Default constructor.
+     *
+     * Constructs a PositionalListItr pointing to nullptr.
+     */
+    PositionalListItr();
+
+    /**
+     * @brief Constructor for an iterator at a given node.
+     *
+     * @param theNode The node to point to.
+     */
+    explicit PositionalListItr(PositionalListNode<T> *theNode);
+
+    /**
+     * @brief Converts a mutable position into a read-only one.
+     *
+     * @param other The position to convert.
+     */
+    template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+    PositionalListItr(const PositionalListItr<T, OtherConst> &other);
+
+    /**
+     * @brief Checks if the iterator is past the end position (on the dummy tail).
+     *
+     * @return True if the iterator is past the end position, false otherwise.
+     */
+    bool isPastEnd() const;
+
+    /**
+     * @brief Checks if the iterator is past the beginning position (on the dummy head).
+     *
+     * @return True if the iterator is past the beginning position, false otherwise.
+     */
+    bool isPastBeginning() const;
+
+    /**
+     * @brief Advances to the next element, unless already past the end.
+     */
+    void moveForward();
+
+    /**
+     * @brief Moves back to the previous element, unless already past the beginning.
+     */
+    void moveBackward();
+
+    /**
+     * @brief Retrieves the value at the current position.
+     *
+     * @return Reference to the value at the current position.
+     */
+    reference retrieve() const;
+
+    /** @brief Standard iterator access to the value at the current position, without checks. */
+    reference operator*() const;
+    pointer operator->() const;
+
+    /** @brief Standard iterator movement, without bounds checks. */
+    PositionalListItr &operator++();
+    PositionalListItr operator++(int);
+    PositionalListItr &operator--();
+    PositionalListItr operator--(int);
+
+    /** @brief Checks whether two iterators point to the same node. */
+    template <bool OtherConst>
+    bool operator==(const PositionalListItr<T, OtherConst> &other) const;
+
+    /** @brief Checks whether two iterators point to different nodes. */
+    template <bool OtherConst>
+    bool operator!=(const PositionalListItr<T, OtherConst> &other) const;
+
+private:
+    PositionalListNode<T> *current; /**< Holds the position in the list. */
+
+    friend class PositionalList<T>;              /**< PositionalList needs access to "current". */
+    friend class PositionalListItr<T, !IsConst>; /**< Conversions and comparisons need access to "current". */
+};
+
+/**
+ * @class PositionalList
+ * @brief Doubly linked list with an indexable skip list layered over its nodes.
+ *
+ * On top of the List API it offers `at`, `insertAt`, `eraseAt` and `indexOf` in expected O(log n)
+ * instead of an O(k) walk. Each node's tower height is drawn with p = 1/4, so there are
+ * 1/3 extra links per node on average. Inserting or erasing at an iterator still relinks
+ * level 0 in O(1), but it must also fix the widths of the jumps that span the node,
+ * which costs expected O(log n) (about three backward steps per level).
+ */
+template <typename T>
+class PositionalList
+{
+public:
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = PositionalListItr<T>;
+    using const_iterator = PositionalListItr<T, true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /**
+     * @brief Default constructor.
+     *
+     * Sets up the dummy head and tail with full-height towers.
+     */
+    PositionalList();
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param source The source PositionalList to be copied.
+     */
+    PositionalList(const PositionalList &source);
+
+    /**
+     * @brief Move constructor.
+     *
+     * Takes over the nodes of `source`, leaving it a working empty list.
+     * @param source The source PositionalList to be moved from.
+     */
+    PositionalList(PositionalList &&source);
+
+    /**
+     * @brief Destructor.
+     */
+    ~PositionalList();
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * @param source The right-hand-side PositionalList to be copied.
+     * @return Reference to the current list.
+     */
+    PositionalList &operator=(const PositionalList &source);
+
+    /**
+     * @brief Move assignment operator.
+     *
+     * @param source The right-hand-side PositionalList to be moved from.
+     * @return Reference to the current list.
+     */
+    PositionalList &operator=(PositionalList &&source);
+
+    /**
+     * @brief Checks if the list is empty.
+     *
+     * @return True if the list is empty, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Removes all elements except the dummy head and tail.
+     */
+    void makeEmpty();
+
+    /**
+     * @brief Returns an iterator to the first element (past the end if the list is empty).
+     *
+     * @return PositionalListItr pointing to the first element.
+     */
+    iterator first();
+
+    /**
+     * @brief Returns an iterator to the last element (past the beginning if the list is empty).
+     *
+     * @return PositionalListItr pointing to the last element.
+     */
+    iterator last();
+
+    /**
+     * @brief Inserts a value after the given position.
+     *
+     * @param x The value to be inserted.
+     * @param position The position to insert after.
+     */
+    void insertAfter(const T &x, iterator position);
+
+    /**
+     * @brief Inserts a value before the given position.
+     *
+     * @param x The value to be inserted.
+     * @param position The position to insert before.
+     */
+    void insertBefore(const T &x, iterator position);
+
+    /**
+     * @brief Inserts a value at the tail of the list.
+     *
+     * @param x The value to be inserted.
+     */
+    void insertAtTail(const T &x);
+
+    /**
+     * @brief Inserts a value at the front of the list.
+     *
+     * @param x The value to be inserted.
+     */
+    void insertAtFront(const T &x);
+
+    /**
+     * @brief Returns an iterator to the first occurrence of a value, or past the end if it is not found.
+     *
+     * The upper links of tall nodes are used to prefetch nodes further ahead while the walk follows level 0.
+     * @param x The value to search for.
+     * @return PositionalListItr pointing to the first occurrence of the value.
+     */
+    iterator find(const T &x);
+
+    /**
+     * @brief Removes the first occurrence of a value from the list.
+     *
+     * @param x The value to be removed.
+     */
+    void remove(const T &x);
+
+    /**
+     * @brief Removes the element at the given position.
+     *
+     * @param position The position of the element to be removed.
+     * @return PositionalListItr pointing to the element that followed the removed one.
+     */
+    iterator erase(iterator position);
+
+    /**
+     * @brief Returns the element at a zero-based index, in expected O(log n).
+     *
+     * @param index The index, in [0, size()).
+     * @return Reference to the element.
+     */
+    T &at(int index);
+
+    /**
+     * @brief Returns an iterator to the element at a zero-based index, in expected O(log n).
+     *
+     * @param index The index, in [0, size()]; size() gives the past-the-end position.
+     * @return PositionalListItr pointing to the element.
+     */
+    iterator itrAt(int index);
+
+    /**
+     * @brief Inserts a value so that it ends up at a zero-based index, in expected O(log n).
+     *
+     * @param index The index, in [0, size()].
+     * @param x The value to be inserted.
+     */
+    void insertAt(int index, const T &x);
+
+    /**
+     * @brief Removes the element at a zero-based index, in expected O(log n).
+     *
+     * @param index The index, in [0, size()).
+     */
+    void eraseAt(int index);
+
+    /**
+     * @brief Returns the zero-based index of the element at a position, in expected O(log n).
+     *
+     * @param position The position of an element; the past-the-end position gives size().
+     * @return The index of the element.
+     */
+    int indexOf(const_iterator position) const;
+
+    /**
+     * @brief Returns the number of elements in the list.
+     *
+     * @return The number of elements in the list.
+     */
+    int size() const;
+
+    /**
+     * @brief Prints the contents of the list forwards (head -> tail) or backwards (tail -> head).
+     *
+     * @param os The output stream to which the list is printed.
+     * @param forward True to print forwards, false to print backwards.
+     */
+    void print(std::ostream &os = std::cout, bool forward = true);
+
+    /** @brief Standard iterator access, as on List; end() is the dummy tail. */
+    iterator begin();
+    const_iterator begin() const;
+    iterator end();
+    const_iterator end() const;
+    reverse_iterator rbegin();
+    reverse_iterator rend();
+
+private:
+    using Node = PositionalListNode<T>;
+    using Link = typename Node::Link;
+
+    static const int maxHeight = 16; // Enough levels for 4^16 elements at p = 1/4
+
+    /**
+     * @brief Allocates a node with a tower of `height` links, all unlinked.
+     *
+     * @param height The number of levels.
+     * @return The new node; its value is not constructed.
+     */
+    static Node *allocateNode(int height);
+
+    /**
+     * @brief Releases the memory of a node whose value has been destroyed (or never constructed).
+     *
+     * @param node The node to release.
+     */
+    static void freeNode(Node *node);
+
+    /**
+     * @brief Draws a tower height: 1 plus one more level with probability 1/4 each time.
+     *
+     * @return The height, in [1, maxHeight].
+     */
+    int randomHeight();
+
+    /**
+     * @brief Returns the node at a rank, where the dummy head is rank 0 and the first element is rank 1.
+     *
+     * @param rank The rank, in [0, size() + 1].
+     * @return The node.
+     */
+    Node *nodeAtRank(std::size_t rank) const;
+
+    /**
+     * @brief Constructs `x` in a new node and links it right after `previous` on every level of its tower.
+     *
+     * @param previous The node to insert after; must not be the dummy tail.
+     * @param x The value to be inserted.
+     */
+    void insertNodeAfter(Node *previous, const T &x);
+
+    /**
+     * @brief Unlinks a node from every level, fixes the widths that spanned it and destroys it.
+     *
+     * @param node The node to remove; must hold an element.
+     */
+    void eraseNode(Node *node);
+
+    /**
+     * @brief Moves every node of `source` into this empty list without copying values.
+     *
+     * @param source The list whose nodes are taken; it is left empty.
+     */
+    void takeNodes(PositionalList &source);
+
+    Node *head;         // Dummy node with a full-height tower, rank 0
+    Node *tail;         // Dummy node with a full-height tower, rank size() + 1
+    int count;          // Number of elements in the list
+    std::uint32_t seed; // State of the xorshift generator that draws tower heights
+};
+
+template <typename T>
+T *PositionalListNode<T>::value()
+{
+    return std::launder(reinterpret_cast<T *>(storage));
+}
+
+template <typename T, bool IsConst>
+PositionalListItr<T, IsConst>::PositionalListItr()
+{
+    current = nullptr;
+}
+
+template <typename T, bool IsConst>
+PositionalListItr<T, IsConst>::PositionalListItr(PositionalListNode<T> *theNode)
+{
+    current = theNode;
+}
+
+template <typename T, bool IsConst>
+template <bool OtherConst, typename>
+PositionalListItr<T, IsConst>::PositionalListItr(const PositionalListItr<T, OtherConst> &other)
+{
+    current = other.current;
+}
+
+template <typename T, bool IsConst>
+bool PositionalListItr<T, IsConst>::isPastEnd() const
+{
+    return current->links[0].next == nullptr;
+}
+
+template <typename T, bool IsConst>
+bool PositionalListItr<T, IsConst>::isPastBeginning() const
+{
+    return current->links[0].previous == nullptr;
+}
+
+template <typename T, bool IsConst>
+void PositionalListItr<T, IsConst>::moveForward()
+{
+    if (current != nullptr && !isPastEnd())
+    {
+        current = current->links[0].next;
+    }
+}
+
+template <typename T, bool IsConst>
+void PositionalListItr<T, IsConst>::moveBackward()
+{
+    if (current != nullptr && !isPastBeginning())
+    {
+        current = current->links[0].previous;
+    }
+}
+
+template <typename T, bool IsConst>
+typename PositionalListItr<T, IsConst>::reference PositionalListItr<T, IsConst>::retrieve() const
+{
+    if (current == nullptr || isPastEnd() || isPastBeginning())
+    {
+        throw std::runtime_error("Attempt to retrieve from a position without an element");
+    }
+    return *current->value();
+}
+
+template <typename T, bool IsConst>
+typename PositionalListItr<T, IsConst>::reference PositionalListItr<T, IsConst>::operator*() const
+{
+    return *current->value();
+}
+
+template <typename T, bool IsConst>
+typename PositionalListItr<T, IsConst>::pointer PositionalListItr<T, IsConst>::operator->() const
+{
+    return current->value();
+}
+
+template <typename T, bool IsConst>
+PositionalListItr<T, IsConst> &PositionalListItr<T, IsConst>::operator++()
+{
+    current = current->links[0].next;
+    return *this;
+}
+
+template <typename T, bool IsConst>
+PositionalListItr<T, IsConst> PositionalListItr<T, IsConst>::operator++(int)
+{
+    PositionalListItr<T, IsConst> old = *this;
+    current = current->links[0].next;
+    return old;
+}
+
+template <typename T, bool IsConst>
+PositionalListItr<T, IsConst> &PositionalListItr<T, IsConst>::operator--()
+{
+    current = current->links[0].previous;
+    return *this;
+}
+
+template <typename T, bool IsConst>
+PositionalListItr<T, IsConst> PositionalListItr<T, IsConst>::operator--(int)
+{
+    PositionalListItr<T, IsConst> old = *this;
+    current = current->links[0].previous;
+    return old;
+}
+
+template <typename T, bool IsConst>
+template <bool OtherConst>
+bool PositionalListItr<T, IsConst>::operator==(const PositionalListItr<T, OtherConst> &other) const
+{
+    return current == other.current;
+}
+
+template <typename T, bool IsConst>
+template <bool OtherConst>
+bool PositionalListItr<T, IsConst>::operator!=(const PositionalListItr<T, OtherConst> &other) const
+{
+    return current != other.current;
+}
+
+template <typename T>
+PositionalList<T>::PositionalList()
+{
+    head = allocateNode(maxHeight);
+    try
+    {
+        tail = allocateNode(maxHeight);
+    }
+    catch (...)
+    {
+        freeNode(head);
+        throw;
+    }
+    for (int level = 0; level < maxHeight; level++)
+    {
+        head->links[level].next = tail;
+        head->links[level].width = 1;
+        tail->links[level].previous = head;
+    }
+    count = 0;
+    seed = 0x9E3779B9u;
+}
+
+template <typename T>
+PositionalList<T>::PositionalList(const PositionalList<T> &source) : PositionalList()
+{
+    // The dummy nodes exist once the delegated constructor returns, so the destructor cleans up if a copy throws
+    for (const T &value : source)
+    {
+        insertAtTail(value);
+    }
+}
+
+template <typename T>
+PositionalList<T>::PositionalList(PositionalList<T> &&source) : PositionalList()
+{
+    takeNodes(source);
+}
+
+template <typename T>
+PositionalList<T>::~PositionalList()
+{
+    makeEmpty();
+    freeNode(head);
+    freeNode(tail);
+}
+
+template <typename T>
+PositionalList<T> &PositionalList<T>::operator=(const PositionalList<T> &source)
+{
+    if (this != &source)
+    {
+        makeEmpty();
+        for (const T &value : source)
+        {
+            insertAtTail(value);
+        }
+    }
+    return *this;
+}
+
+template <typename T>
+PositionalList<T> &PositionalList<T>::operator=(PositionalList<T> &&source)
+{
+    if (this != &source)
+    {
+        makeEmpty();
+        takeNodes(source);
+    }
+    return *this;
+}
+
+template <typename T>
+bool PositionalList<T>::isEmpty() const
+{
+    return count == 0;
+}
+
+template <typename T>
+void PositionalList<T>::makeEmpty()
+{
+    Node *node = head->links[0].next;
+    while (node != tail)
+    {
+        Node *next = node->links[0].next;
+        node->value()->~T();
+        freeNode(node);
+        node = next;
+    }
+    for (int level = 0; level < maxHeight; level++)
+    {
+        head->links[level].next = tail;
+        head->links[level].width = 1;
+        tail->links[level].previous = head;
+    }
+    count = 0;
+}
+
+template <typename T>
+typename PositionalList<T>::iterator PositionalList<T>::first()
+{
+    return iterator(head->links[0].next);
+}
+
+template <typename T>
+typename PositionalList<T>::iterator PositionalList<T>::last()
+{
+    return iterator(tail->links[0].previous);
+}
+
+template <typename T>
+void PositionalList<T>::insertAfter(const T &x, iterator position)
+{
+    if (position.isPastEnd())
+    {
+        throw std::invalid_argument("Cannot insert after the end of the list.");
+    }
+    insertNodeAfter(position.current, x);
+}
+
+template <typename T>
+void PositionalList<T>::insertBefore(const T &x, iterator position)
+{
+    if (position.isPastBeginning())
+    {
+        throw std::invalid_argument("Cannot insert before the beginning of the list.");
+    }
+    insertNodeAfter(position.current->links[0].previous, x);
+}
+
+template <typename T>
+void PositionalList<T>::insertAtTail(const T &x)
+{
+    insertNodeAfter(tail->links[0].previous, x);
+}
+
+template <typename T>
+void PositionalList<T>::insertAtFront(const T &x)
+{
+    insertNodeAfter(head, x);
+}
+
+template <typename T>
+typename PositionalList<T>::iterator PositionalList<T>::find(const T &x)
+{
+    Node *node = head->links[0].next;
+    while (node != tail)
+    {
+        // The skip links point several nodes ahead, so these loads are independent of the level-0 chain
+        prefetchForRead(node->links[0].next);
+        if (node->height > 1)
+        {
+            prefetchForRead(node->links[1].next);
+        }
+        if (!(*node->value() != x))
+        {
+            break;
+        }
+        node = node->links[0].next;
+    }
+    return iterator(node);
+}
+
+template <typename T>
+void PositionalList<T>::remove(const T &x)
+{
+    iterator itr = find(x);
+    if (!itr.isPastEnd())
+    {
+        eraseNode(itr.current);
+    }
+}
+
+template <typename T>
+typename PositionalList<T>::iterator PositionalList<T>::erase(iterator position)
+{
+    if (position.isPastEnd() || position.isPastBeginning())
+    {
+        throw std::invalid_argument("Cannot erase a dummy head or tail node.");
+    }
+    Node *next = position.current->links[0].next;
+    eraseNode(position.current);
+    return iterator(next);
+}
+
+template <typename T>
+T &PositionalList<T>::at(int index)
+{
+    if (index < 0 || index >= count)
+    {
+        throw std::out_of_range("Index is outside the list.");
+    }
+    return *nodeAtRank(static_cast<std::size_t>(index) + 1)->value();
+}
+
+template <typename T>
+typename PositionalList<T>::iterator PositionalList<T>::itrAt(int index)
+{
+    if (index < 0 || index > count)
+    {
+        throw std::out_of_range("Index is outside the list.");
+    }
+    return iterator(nodeAtRank(static_cast<std::size_t>(index) + 1));
+}
+
+template <typename T>
+void PositionalList<T>::insertAt(int index, const T &x)
+{
+    if (index < 0 || index > count)
+    {
+        throw std::out_of_range("Index is outside the list.");
+    }
+    insertNodeAfter(nodeAtRank(static_cast<std::size_t>(index)), x);
+}
+
+template <typename T>
+void PositionalList<T>::eraseAt(int index)
+{
+    if (index < 0 || index >= count)
+    {
+        throw std::out_of_range("Index is outside the list.");
+    }
+    eraseNode(nodeAtRank(static_cast<std::size_t>(index) + 1));
+}
+
+template <typename T>
+int PositionalList<T>::indexOf(const_iterator position) const
+{
+    if (position.isPastBeginning())
+    {
+        throw std::invalid_argument("The dummy head node has no index.");
+    }
+
+    // Walk back to the head along the highest level of each node reached; the widths add up to the rank
+    std::size_t rank = 0;
+    Node *node = position.current;
+    while (node != head)
+    {
+        Node *previous = node->links[node->height - 1].previous;
+        rank += previous->links[node->height - 1].width;
+        node = previous;
+    }
+    return static_cast<int>(rank) - 1;
+}
+
+template <typename T>
+int PositionalList<T>::size() const
+{
+    return count;
+}
+
+template <typename T>
+void PositionalList<T>::print(std::ostream &os, bool forward)
+{
+    if (forward)
+    {
+        for (iterator itr = first(); !itr.isPastEnd(); itr.moveForward())
+        {
+            os << itr.retrieve() << " ";
+        }
+    }
+    else
+    {
+        for (iterator itr = last(); !itr.isPastBeginning(); itr.moveBackward())
+        {
+            os << itr.retrieve() << " ";
+        }
+    }
+    os << std::endl;
+}
+
+template <typename T>
+typename PositionalList<T>::iterator PositionalList<T>::begin()
+{
+    return first();
+}
+
+template <typename T>
+typename PositionalList<T>::const_iterator PositionalList<T>::begin() const
+{
+    return const_iterator(head->links[0].next);
+}
+
+template <typename T>
+typename PositionalList<T>::iterator PositionalList<T>::end()
+{
+    return iterator(tail);
+}
+
+template <typename T>
+typename PositionalList<T>::const_iterator PositionalList<T>::end() const
+{
+    return const_iterator(tail);
+}
+
+template <typename T>
+typename PositionalList<T>::reverse_iterator PositionalList<T>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <typename T>
+typename PositionalList<T>::reverse_iterator PositionalList<T>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template <typename T>
+typename PositionalList<T>::Node *PositionalList<T>::allocateNode(int height)
+{
+    void *memory = ::operator new(sizeof(Node) + static_cast<std::size_t>(height) * sizeof(Link));
+    Node *node = new (memory) Node;
+    node->links = reinterpret_cast<Link *>(static_cast<unsigned char *>(memory) + sizeof(Node));
+    for (int level = 0; level < height; level++)
+    {
+        new (&node->links[level]) Link{nullptr, nullptr, 0};
+    }
+    node->height = height;
+    return node;
+}
+
+template <typename T>
+void PositionalList<T>::freeNode(Node *node)
+{
+    ::operator delete(static_cast<void *>(node));
+}
+
+template <typename T>
+int PositionalList<T>::randomHeight()
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    std::uint32_t bits = seed;
+    int height = 1;
+    while (height < maxHeight && (bits & 3u) == 0)
+    {
+        height++;
+        bits >>= 2;
+    }
+    return height;
+}
+
+template <typename T>
+typename PositionalList<T>::Node *PositionalList<T>::nodeAtRank(std::size_t rank) const
+{
+    Node *node = head;
+    std::size_t reached = 0;
+    for (int level = maxHeight - 1; level >= 0; level--)
+    {
+        while (reached < rank && reached + node->links[level].width <= rank)
+        {
+            reached += node->links[level].width;
+            node = node->links[level].next;
+        }
+    }
+    return node;
+}
+
+template <typename T>
+void PositionalList<T>::insertNodeAfter(Node *previous, const T &x)
+{
+    Node *node = allocateNode(randomHeight());
+    try
+    {
+        new (node->storage) T(x);
+    }
+    catch (...)
+    {
+        freeNode(node);
+        throw;
+    }
+
+    // For each level, find the nearest node before the new one whose tower reaches that level,
+    // and the number of level-0 steps from it to the new node
+    Node *before = previous;
+    std::size_t distance = 1;
+    for (int level = 0; level < maxHeight; level++)
+    {
+        while (before->height <= level)
+        {
+            Node *back = before->links[level - 1].previous;
+            distance += back->links[level - 1].width;
+            before = back;
+        }
+
+        Link &jump = before->links[level];
+        if (level < node->height)
+        {
+            Node *after = jump.next;
+            node->links[level].next = after;
+            node->links[level].previous = before;
+            node->links[level].width = jump.width + 1 - distance;
+            after->links[level].previous = node;
+            jump.next = node;
+            jump.width = distance;
+        }
+        else
+        {
+            jump.width++;
+        }
+    }
+    count++;
+}
+
+template <typename T>
+void PositionalList<T>::eraseNode(Node *node)
+{
+    Node *before = node;
+    for (int level = 0; level < maxHeight; level++)
+    {
+        if (level < node->height)
+        {
+            Link &own = node->links[level];
+            Link &jump = own.previous->links[level];
+            jump.next = own.next;
+            jump.width += own.width - 1;
+            own.next->links[level].previous = own.previous;
+            before = own.previous;
+        }
+        else
+        {
+            while (before->height <= level)
+            {
+                before = before->links[level - 1].previous;
+            }
+            before->links[level].width--;
+        }
+    }
+
+    node->value()->~T();
+    freeNode(node);
+    count--;
+}
+
+template <typename T>
+void PositionalList<T>::takeNodes(PositionalList<T> &source)
+{
+    std::swap(head, source.head);
+    std::swap(tail, source.tail);
+    std::swap(count, source.count);
+}
+
+#endif
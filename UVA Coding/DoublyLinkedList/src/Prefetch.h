@@ -0,0 +1,37 @@
+#ifndef PREFETCH_H
+#define PREFETCH_H
+
+#include <cstddef>
+
+/**
+ * @brief Asks the CPU to start loading the cache line that holds `address`, for reading.
+ *
+ * Only a hint: it never faults, even for an invalid address, and compiles to nothing on compilers
+ * without __builtin_prefetch.
+ * @param address Any address.
+ */
+inline void prefetchForRead(const void *address)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, 0, 3);
+#else
+    (void)address;
+#endif
+}
+
+/**
+ * @brief Asks the CPU to start loading every cache line of [address, address + bytes), for reading.
+ *
+ * @param address The start of the range.
+ * @param bytes The length of the range.
+ */
+inline void prefetchRangeForRead(const void *address, std::size_t bytes)
+{
+    const char *line = static_cast<const char *>(address);
+    for (std::size_t offset = 0; offset < bytes; offset += 64)
+    {
+        prefetchForRead(line + offset);
+    }
+}
+
+#endif
@@ -0,0 +1,314 @@
+#ifndef SELFORGANIZINGLIST_H
+#define SELFORGANIZINGLIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <utility>
+
+#include "List.h"
+
+/**
+ * @brief Self-organizing policy that moves every node found to the front of the list.
+ *
+ * Adapts fastest to a change in which keys are popular, at the price of letting a single lookup of a
+ * rare key push every popular one back by one position.
+ */
+struct MoveToFrontPolicy
+{
+    // No per-node state
+    struct Counter
+    {
+    };
+
+    /**
+     * @brief Relinks the node at `hit` to the front of `list`.
+     *
+     * @param list The list that holds the node.
+     * @param hit The position of the node found.
+     */
+    template <typename ListType, typename Position>
+    static void promote(ListType &list, Position hit)
+    {
+        list.moveToFront(hit);
+    }
+};
+
+/**
+ * @brief Self-organizing policy that swaps every node found with its predecessor.
+ *
+ * A key climbs one position per lookup, so the order converges more slowly than with move-to-front
+ * but a rare lookup barely disturbs it.
+ */
+struct TransposePolicy
+{
+    // No per-node state
+    struct Counter
+    {
+    };
+
+    /**
+     * @brief Relinks the node at `hit` in front of its predecessor, if it has one.
+     *
+     * @param list The list that holds the node.
+     * @param hit The position of the node found.
+     */
+    template <typename ListType, typename Position>
+    static void promote(ListType &list, Position hit)
+    {
+        Position before = hit;
+        before.moveBackward();
+        if (!before.isPastBeginning())
+        {
+            list.splice(before, list, hit);
+        }
+    }
+};
+
+/**
+ * @brief Self-organizing policy that keeps the nodes ordered by how often they were found.
+ *
+ * Each node carries a hit counter. A node found moves in front of every node with fewer hits, after
+ * the nodes with as many, which takes a backward walk over the nodes it passes but a single relink.
+ */
+struct CountPolicy
+{
+    struct Counter
+    {
+        std::size_t hits = 0; /**< Number of times the node was found. */
+    };
+
+    /**
+     * @brief Counts a hit on the node at `hit` and relinks it in front of the nodes with fewer hits.
+     *
+     * @param list The list that holds the node.
+     * @param hit The position of the node found.
+     */
+    template <typename ListType, typename Position>
+    static void promote(ListType &list, Position hit)
+    {
+        std::size_t hits = ++hit.retrieve().hits;
+        Position before = hit;
+        before.moveBackward();
+        while (!before.isPastBeginning() && before.retrieve().hits < hits)
+        {
+            before.moveBackward();
+        }
+        before.moveForward();
+        if (before != hit)
+        {
+            list.splice(before, list, hit);
+        }
+    }
+};
+
+/**
+ * @brief The element type SelfOrganizingList stores in its List: the value and the policy's counter.
+ *
+ * The counter is a base class, so the empty counters of MoveToFrontPolicy and TransposePolicy take no space.
+ */
+template <typename T, typename Counter>
+struct SelfOrganizingEntry : Counter
+{
+    T value; /**< The element. */
+
+    SelfOrganizingEntry() : Counter(), value() {}
+    explicit SelfOrganizingEntry(const T &v) : Counter(), value(v) {}
+    explicit SelfOrganizingEntry(T &&v) : Counter(), value(std::move(v)) {}
+};
+
+/**
+ * @class SelfOrganizingList
+ * @brief A List whose successful finds relink the node found toward the front.
+ *
+ * Under a skewed access pattern the popular values gather near the head, so `find` walks far fewer nodes
+ * than List::find over insertion order. The relinking is done by `Policy` (MoveToFrontPolicy, TransposePolicy
+ * or CountPolicy) with O(1) pointer updates on the existing node: nothing is allocated, copied or moved.
+ * `Stats` is the statistics policy of the underlying List (see ListStats.h); with CountingListStats,
+ * statistics() reports the average and longest walk per find.
+ */
+template <typename T, typename Policy = MoveToFrontPolicy, typename Stats = NoListStats>
+class SelfOrganizingList
+{
+public:
+    /**
+     * @brief Default constructor.
+     *
+     * Creates an empty list.
+     */
+    SelfOrganizingList() = default;
+
+    /**
+     * @brief Checks if the list is empty.
+     *
+     * @return True if the list is empty, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Returns the number of elements in the list.
+     *
+     * @return The number of elements.
+     */
+    int size() const;
+
+    /**
+     * @brief Removes all elements.
+     */
+    void makeEmpty();
+
+    /**
+     * @brief Inserts a value at the tail, where a value that has never been found belongs.
+     *
+     * @param x The value to insert.
+     */
+    void insertAtTail(const T &x);
+
+    /**
+     * @brief Inserts a value at the front.
+     *
+     * With CountPolicy the value starts with no hits, so the next find of a value behind it moves ahead of it.
+     * @param x The value to insert.
+     */
+    void insertAtFront(const T &x);
+
+    /**
+     * @brief Finds the first occurrence of `x` and lets the policy move it toward the front.
+     *
+     * @param x The value to find.
+     * @return Pointer to the value found, or nullptr if there is none. Valid until the value is removed.
+     */
+    T *find(const T &x);
+
+    /**
+     * @brief Checks whether `x` is in the list, without reorganizing it.
+     *
+     * @param x The value to look for.
+     * @return True if the list holds `x`.
+     */
+    bool contains(const T &x) const;
+
+    /**
+     * @brief Removes the first occurrence of `x`, if any.
+     *
+     * @param x The value to remove.
+     * @return True if a value was removed.
+     */
+    bool remove(const T &x);
+
+    /**
+     * @brief Calls `f` on each value from first to last.
+     *
+     * @param f Function object taking a const T&.
+     * @return `f`, after the last call.
+     */
+    template <typename Function>
+    Function forEach(Function f) const;
+
+    /**
+     * @brief Prints the values from first to last, separated by spaces.
+     *
+     * @param os The output stream.
+     */
+    void print(std::ostream &os = std::cout) const;
+
+    /**
+     * @brief Returns the counters of the statistics policy of the underlying List.
+     *
+     * @return The counters, all zero with NoListStats.
+     */
+    ListStatsSnapshot statistics() const;
+
+private:
+    using Entry = SelfOrganizingEntry<T, typename Policy::Counter>;
+
+    List<Entry, std::allocator<Entry>, Stats> entries; // The values, in the order the policy keeps them
+};
+
+template <typename T, typename Policy, typename Stats>
+bool SelfOrganizingList<T, Policy, Stats>::isEmpty() const
+{
+    return entries.isEmpty();
+}
+
+template <typename T, typename Policy, typename Stats>
+int SelfOrganizingList<T, Policy, Stats>::size() const
+{
+    return entries.size();
+}
+
+template <typename T, typename Policy, typename Stats>
+void SelfOrganizingList<T, Policy, Stats>::makeEmpty()
+{
+    entries.makeEmpty();
+}
+
+template <typename T, typename Policy, typename Stats>
+void SelfOrganizingList<T, Policy, Stats>::insertAtTail(const T &x)
+{
+    entries.emplaceBack(x);
+}
+
+template <typename T, typename Policy, typename Stats>
+void SelfOrganizingList<T, Policy, Stats>::insertAtFront(const T &x)
+{
+    entries.emplaceFront(x);
+}
+
+template <typename T, typename Policy, typename Stats>
+T *SelfOrganizingList<T, Policy, Stats>::find(const T &x)
+{
+    ListItr<Entry> hit = entries.findIf([&x](const Entry &entry) { return !(entry.value != x); });
+    if (hit.isPastEnd())
+    {
+        return nullptr;
+    }
+    Policy::promote(entries, hit);
+    return &hit.retrieve().value;
+}
+
+template <typename T, typename Policy, typename Stats>
+bool SelfOrganizingList<T, Policy, Stats>::contains(const T &x) const
+{
+    return std::find_if(entries.begin(), entries.end(), [&x](const Entry &entry) { return !(entry.value != x); }) !=
+           entries.end();
+}
+
+template <typename T, typename Policy, typename Stats>
+bool SelfOrganizingList<T, Policy, Stats>::remove(const T &x)
+{
+    ListItr<Entry> hit = entries.findIf([&x](const Entry &entry) { return !(entry.value != x); });
+    if (hit.isPastEnd())
+    {
+        return false;
+    }
+    entries.erase(hit);
+    return true;
+}
+
+template <typename T, typename Policy, typename Stats>
+template <typename Function>
+Function SelfOrganizingList<T, Policy, Stats>::forEach(Function f) const
+{
+    for (const Entry &entry : entries)
+    {
+        f(static_cast<const T &>(entry.value));
+    }
+    return f;
+}
+
+template <typename T, typename Policy, typename Stats>
+void SelfOrganizingList<T, Policy, Stats>::print(std::ostream &os) const
+{
+    forEach([&os](const T &value) { os << value << " "; });
+    os << std::endl;
+}
+
+template <typename T, typename Policy, typename Stats>
+ListStatsSnapshot SelfOrganizingList<T, Policy, Stats>::statistics() const
+{
+    return entries.statistics();
+}
+
+#endif
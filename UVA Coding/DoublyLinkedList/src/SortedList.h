@@ -0,0 +1,999 @@
+#ifndef SORTEDLIST_H
+#define SORTEDLIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+template <typename T, typename Compare>
+class SortedList;
+
+/**
+ * @class SortedListNode
+ * @brief A node of a SortedList: the value, the level-0 next and previous links, and the skip pointers.
+ *
+ * Level 0 is the ordinary doubly linked list. A node whose tower is taller than one level stores a forward
+ * pointer for each level above 0 right after the node, in the same allocation, so a node of height 1 costs
+ * no more than a ListNode plus the height. The dummy head and tail hold no value.
+ */
+template <typename T>
+class SortedListNode
+{
+private:
+    /**
+     * @brief Returns the value stored in the node.
+     *
+     * @return Pointer to the value.
+     */
+    T *value();
+
+    /**
+     * @brief Returns the forward link of a level of the tower.
+     *
+     * @param level The level, in [0, height); level 0 is `next`.
+     * @return Reference to the link.
+     */
+    SortedListNode *&forward(int level);
+
+    SortedListNode *next;                        /**< Next node on level 0. */
+    SortedListNode *previous;                    /**< Previous node on level 0. */
+    int height;                                  /**< Number of levels this node takes part in. */
+    alignas(T) unsigned char storage[sizeof(T)]; /**< Storage for the value (unused in the dummy nodes). */
+
+    template <typename>
+    friend class SortedListItr; /**< SortedListItr needs access to the value and level-0 links. */
+    template <typename, typename>
+    friend class SortedList; /**< SortedList needs access to the value and links. */
+};
+
+/**
+ * @class SortedListItr
+ * @brief Position in a SortedList.
+ *
+ * Offers both the ListItr vocabulary (moveForward, retrieve, isPastEnd, ...) and the standard
+ * bidirectional iterator operators. The value is read-only, since changing it could break the order.
+ * Like a ListItr, it stays valid until its own element is erased.
+ */
+template <typename T>
+class SortedListItr
+{
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = const T &;
+
+    /**
+     * @brief Default constructor.
+     *
+     * Constructs a SortedListItr pointing to nullptr.
+     */
+    SortedListItr();
+
+    /**
+     * @brief Constructor for an iterator at a given node.
+     *
+     * @param theNode The node to point to.
+     */
+    explicit SortedListItr(SortedListNode<T> *theNode);
+
+    /**
+     * @brief Checks if the iterator is past the end position (on the dummy tail).
+     *
+     * @return True if the iterator is past the end position, false otherwise.
+     */
+    bool isPastEnd() const;
+
+    /**
+     * @brief Checks if the iterator is past the beginning position (on the dummy head).
+     *
+     * @return True if the iterator is past the beginning position, false otherwise.
+     */
+    bool isPastBeginning() const;
+
+    /**
+     * @brief Advances to the next element, unless already past the end.
+     */
+    void moveForward();
+
+    /**
+     * @brief Moves back to the previous element, unless already past the beginning.
+     */
+    void moveBackward();
+
+    /**
+     * @brief Retrieves the value at the current position.
+     *
+     * @return Reference to the value at the current position.
+     */
+    const T &retrieve() const;
+
+    /** @brief Standard iterator access to the value at the current position, without checks. */
+    const T &operator*() const;
+    const T *operator->() const;
+
+    /** @brief Standard iterator movement, without bounds checks. */
+    SortedListItr &operator++();
+    SortedListItr operator++(int);
+    SortedListItr &operator--();
+    SortedListItr operator--(int);
+
+    /** @brief Checks whether two iterators point to the same node. */
+    bool operator==(const SortedListItr &other) const;
+
+    /** @brief Checks whether two iterators point to different nodes. */
+    bool operator!=(const SortedListItr &other) const;
+
+private:
+    SortedListNode<T> *current; /**< Holds the position in the list. */
+
+    template <typename, typename>
+    friend class SortedList; /**< SortedList needs access to "current". */
+};
+
+/**
+ * @class SortedListRange
+ * @brief The elements of a SortedList in [lo, hi), as returned by SortedList::range.
+ */
+template <typename T>
+class SortedListRange
+{
+public:
+    /**
+     * @brief Constructor for the range [first, last).
+     *
+     * @param first The position of the first element in the range.
+     * @param last The position right after the last element in the range.
+     */
+    SortedListRange(SortedListItr<T> first, SortedListItr<T> last);
+
+    /**
+     * @brief Checks if the range holds no element.
+     *
+     * @return True if the range is empty, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /** @brief Standard iterator access, for range-based for loops and algorithms. */
+    SortedListItr<T> begin() const;
+    SortedListItr<T> end() const;
+
+private:
+    SortedListItr<T> first; /**< The first element in the range. */
+    SortedListItr<T> last;  /**< The position right after the range. */
+};
+
+/**
+ * @class SortedList
+ * @brief Doubly linked list kept in `Compare` order, with a skip list layered over its nodes.
+ *
+ * Replaces the find-then-insertBefore pattern that keeps a List sorted in O(n) per insert:
+ * `insert`, `lowerBound`, `upperBound`, `contains` and `erase` descend the skip levels in expected O(log n),
+ * while in-order traversal follows level 0 in both directions exactly like a List. `range(lo, hi)`
+ * costs one descent and then walks [lo, hi) along level 0. Equal elements are kept, in insertion order.
+ * Each node's tower height is drawn with p = 1/4, so there are 1/3 extra forward pointers per node
+ * on average; unlike PositionalList, the upper levels are forward-only and carry no widths.
+ */
+template <typename T, typename Compare = std::less<T>>
+class SortedList
+{
+public:
+    using value_type = T;
+    using reference = const T &;
+    using const_reference = const T &;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using key_compare = Compare;
+    using iterator = SortedListItr<T>;
+    using const_iterator = SortedListItr<T>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /**
+     * @brief Default constructor.
+     *
+     * Sets up the dummy head with a full-height tower and the dummy tail.
+     */
+    SortedList();
+
+    /**
+     * @brief Constructor for an empty list ordered by `compare`.
+     *
+     * @param compare The strict weak ordering of the elements.
+     */
+    explicit SortedList(const Compare &compare);
+
+    /**
+     * @brief Copy constructor.
+     *
+     * The source is already sorted, so each element is appended in O(1) without a descent.
+     * @param source The source SortedList to be copied.
+     */
+    SortedList(const SortedList &source);
+
+    /**
+     * @brief Move constructor.
+     *
+     * Takes over the nodes of `source`, leaving it a working empty list.
+     * @param source The source SortedList to be moved from.
+     */
+    SortedList(SortedList &&source);
+
+    /**
+     * @brief Destructor.
+     */
+    ~SortedList();
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * @param source The right-hand-side SortedList to be copied.
+     * @return Reference to the current list.
+     */
+    SortedList &operator=(const SortedList &source);
+
+    /**
+     * @brief Move assignment operator.
+     *
+     * @param source The right-hand-side SortedList to be moved from.
+     * @return Reference to the current list.
+     */
+    SortedList &operator=(SortedList &&source);
+
+    /**
+     * @brief Checks if the list is empty.
+     *
+     * @return True if the list is empty, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Removes all elements except the dummy head and tail.
+     */
+    void makeEmpty();
+
+    /**
+     * @brief Returns an iterator to the smallest element (past the end if the list is empty).
+     *
+     * @return SortedListItr pointing to the first element.
+     */
+    iterator first() const;
+
+    /**
+     * @brief Returns an iterator to the largest element (past the beginning if the list is empty).
+     *
+     * @return SortedListItr pointing to the last element.
+     */
+    iterator last() const;
+
+    /**
+     * @brief Inserts a value at its place in the order, in expected O(log n).
+     *
+     * The value goes after every element equal to it.
+     * @param x The value to be inserted.
+     * @return SortedListItr pointing to the new element.
+     */
+    iterator insert(const T &x);
+
+    /**
+     * @brief Removes the first element equal to `x`, in expected O(log n).
+     *
+     * @param x The value to be removed.
+     * @return True if an element was removed.
+     */
+    bool erase(const T &x);
+
+    /**
+     * @brief Removes the element at the given position, in expected O(log n).
+     *
+     * @param position The position of the element to be removed.
+     * @return SortedListItr pointing to the element that followed the removed one.
+     */
+    iterator erase(iterator position);
+
+    /**
+     * @brief Returns the first element not less than `x`, in expected O(log n).
+     *
+     * @param x The value to search for.
+     * @return SortedListItr pointing to the element, or past the end if there is none.
+     */
+    iterator lowerBound(const T &x) const;
+
+    /**
+     * @brief Returns the first element greater than `x`, in expected O(log n).
+     *
+     * @param x The value to search for.
+     * @return SortedListItr pointing to the element, or past the end if there is none.
+     */
+    iterator upperBound(const T &x) const;
+
+    /**
+     * @brief Checks whether an element equal to `x` is in the list, in expected O(log n).
+     *
+     * @param x The value to search for.
+     * @return True if the list holds `x`.
+     */
+    bool contains(const T &x) const;
+
+    /**
+     * @brief Returns the elements in [lo, hi), in order.
+     *
+     * The range is empty if `hi` is not greater than `lo`.
+     * @param lo The smallest value included.
+     * @param hi The smallest value excluded.
+     * @return The range, valid until one of its elements is erased.
+     */
+    SortedListRange<T> range(const T &lo, const T &hi) const;
+
+    /**
+     * @brief Returns the number of elements in the list.
+     *
+     * @return The number of elements in the list.
+     */
+    int size() const;
+
+    /**
+     * @brief Prints the contents of the list forwards (smallest first) or backwards (largest first).
+     *
+     * @param os The output stream to which the list is printed.
+     * @param forward True to print forwards, false to print backwards.
+     */
+    void print(std::ostream &os = std::cout, bool forward = true) const;
+
+    /** @brief Standard iterator access, as on List; end() is the dummy tail. */
+    iterator begin() const;
+    iterator end() const;
+    reverse_iterator rbegin() const;
+    reverse_iterator rend() const;
+
+private:
+    using Node = SortedListNode<T>;
+
+    static const int maxHeight = 16; // Enough levels for 4^16 elements at p = 1/4
+
+    /**
+     * @brief Allocates a node with a tower of `height` links, all null.
+     *
+     * @param height The number of levels.
+     * @return The new node; its value is not constructed.
+     */
+    static Node *allocateNode(int height);
+
+    /**
+     * @brief Releases the memory of a node whose value has been destroyed (or never constructed).
+     *
+     * @param node The node to release.
+     */
+    static void freeNode(Node *node);
+
+    /**
+     * @brief Draws a tower height: 1 plus one more level with probability 1/4 each time.
+     *
+     * @return The height, in [1, maxHeight].
+     */
+    int randomHeight();
+
+    /**
+     * @brief Walks down from the top level in use, moving right while `before` holds for the next value.
+     *
+     * @param before Predicate on a value; must hold for a prefix of the list.
+     * @param update If not null, receives the last node reached on each level in use.
+     * @return The last node on level 0 for which `before` holds, or the dummy head.
+     */
+    template <typename Before>
+    Node *descend(Before before, Node **update) const;
+
+    /**
+     * @brief Unlinks a node from every level of its tower and destroys it.
+     *
+     * @param node The node to remove; must hold an element.
+     * @param update The node right before `node` on each level of its tower.
+     */
+    void eraseNode(Node *node, Node **update);
+
+    /**
+     * @brief Appends copies of the elements of `source` to this empty list, in O(n).
+     *
+     * @param source The list to copy.
+     */
+    void copyNodes(const SortedList &source);
+
+    /**
+     * @brief Points the last node of each level at the dummy tail.
+     *
+     * @param last The last node on each level, maxHeight entries.
+     */
+    void closeLevels(Node **last);
+
+    /**
+     * @brief Moves every node of `source` into this empty list without copying values.
+     *
+     * @param source The list whose nodes are taken; it is left empty.
+     */
+    void takeNodes(SortedList &source);
+
+    Node *head;         // Dummy node with a full-height tower, before the smallest element
+    Node *tail;         // Dummy node of height 1, after the largest element
+    int count;          // Number of elements in the list
+    int levels;         // Number of levels with at least one element, or 1
+    std::uint32_t seed; // State of the xorshift generator that draws tower heights
+    Compare comp;       // The order of the elements
+};
+
+template <typename T>
+T *SortedListNode<T>::value()
+{
+    return std::launder(reinterpret_cast<T *>(storage));
+}
+
+template <typename T>
+SortedListNode<T> *&SortedListNode<T>::forward(int level)
+{
+    if (level == 0)
+    {
+        return next;
+    }
+    SortedListNode<T> **skips = reinterpret_cast<SortedListNode<T> **>(reinterpret_cast<unsigned char *>(this) +
+                                                                       sizeof(SortedListNode<T>));
+    return skips[level - 1];
+}
+
+template <typename T>
+SortedListItr<T>::SortedListItr()
+{
+    current = nullptr;
+}
+
+template <typename T>
+SortedListItr<T>::SortedListItr(SortedListNode<T> *theNode)
+{
+    current = theNode;
+}
+
+template <typename T>
+bool SortedListItr<T>::isPastEnd() const
+{
+    return current->next == nullptr;
+}
+
+template <typename T>
+bool SortedListItr<T>::isPastBeginning() const
+{
+    return current->previous == nullptr;
+}
+
+template <typename T>
+void SortedListItr<T>::moveForward()
+{
+    if (current != nullptr && !isPastEnd())
+    {
+        current = current->next;
+    }
+}
+
+template <typename T>
+void SortedListItr<T>::moveBackward()
+{
+    if (current != nullptr && !isPastBeginning())
+    {
+        current = current->previous;
+    }
+}
+
+template <typename T>
+const T &SortedListItr<T>::retrieve() const
+{
+    if (current == nullptr || isPastEnd() || isPastBeginning())
+    {
+        throw std::runtime_error("Attempt to retrieve from a position without an element");
+    }
+    return *current->value();
+}
+
+template <typename T>
+const T &SortedListItr<T>::operator*() const
+{
+    return *current->value();
+}
+
+template <typename T>
+const T *SortedListItr<T>::operator->() const
+{
+    return current->value();
+}
+
+template <typename T>
+SortedListItr<T> &SortedListItr<T>::operator++()
+{
+    current = current->next;
+    return *this;
+}
+
+template <typename T>
+SortedListItr<T> SortedListItr<T>::operator++(int)
+{
+    SortedListItr<T> old = *this;
+    current = current->next;
+    return old;
+}
+
+template <typename T>
+SortedListItr<T> &SortedListItr<T>::operator--()
+{
+    current = current->previous;
+    return *this;
+}
+
+template <typename T>
+SortedListItr<T> SortedListItr<T>::operator--(int)
+{
+    SortedListItr<T> old = *this;
+    current = current->previous;
+    return old;
+}
+
+template <typename T>
+bool SortedListItr<T>::operator==(const SortedListItr<T> &other) const
+{
+    return current == other.current;
+}
+
+template <typename T>
+bool SortedListItr<T>::operator!=(const SortedListItr<T> &other) const
+{
+    return current != other.current;
+}
+
+template <typename T>
+SortedListRange<T>::SortedListRange(SortedListItr<T> first, SortedListItr<T> last) : first(first), last(last)
+{
+}
+
+template <typename T>
+bool SortedListRange<T>::isEmpty() const
+{
+    return first == last;
+}
+
+template <typename T>
+SortedListItr<T> SortedListRange<T>::begin() const
+{
+    return first;
+}
+
+template <typename T>
+SortedListItr<T> SortedListRange<T>::end() const
+{
+    return last;
+}
+
+template <typename T, typename Compare>
+SortedList<T, Compare>::SortedList() : SortedList(Compare())
+{
+}
+
+template <typename T, typename Compare>
+SortedList<T, Compare>::SortedList(const Compare &compare) : comp(compare)
+{
+    head = allocateNode(maxHeight);
+    try
+    {
+        tail = allocateNode(1);
+    }
+    catch (...)
+    {
+        freeNode(head);
+        throw;
+    }
+    for (int level = 0; level < maxHeight; level++)
+    {
+        head->forward(level) = tail;
+    }
+    tail->previous = head;
+    count = 0;
+    levels = 1;
+    seed = 0x9E3779B9u;
+}
+
+template <typename T, typename Compare>
+SortedList<T, Compare>::SortedList(const SortedList<T, Compare> &source) : SortedList(source.comp)
+{
+    // The dummy nodes exist once the delegated constructor returns, so the destructor cleans up if a copy throws
+    copyNodes(source);
+}
+
+template <typename T, typename Compare>
+SortedList<T, Compare>::SortedList(SortedList<T, Compare> &&source) : SortedList(source.comp)
+{
+    takeNodes(source);
+}
+
+template <typename T, typename Compare>
+SortedList<T, Compare>::~SortedList()
+{
+    makeEmpty();
+    freeNode(head);
+    freeNode(tail);
+}
+
+template <typename T, typename Compare>
+SortedList<T, Compare> &SortedList<T, Compare>::operator=(const SortedList<T, Compare> &source)
+{
+    if (this != &source)
+    {
+        makeEmpty();
+        comp = source.comp;
+        copyNodes(source);
+    }
+    return *this;
+}
+
+template <typename T, typename Compare>
+SortedList<T, Compare> &SortedList<T, Compare>::operator=(SortedList<T, Compare> &&source)
+{
+    if (this != &source)
+    {
+        makeEmpty();
+        comp = source.comp;
+        takeNodes(source);
+    }
+    return *this;
+}
+
+template <typename T, typename Compare>
+bool SortedList<T, Compare>::isEmpty() const
+{
+    return count == 0;
+}
+
+template <typename T, typename Compare>
+void SortedList<T, Compare>::makeEmpty()
+{
+    Node *node = head->next;
+    while (node != tail)
+    {
+        Node *next = node->next;
+        node->value()->~T();
+        freeNode(node);
+        node = next;
+    }
+    for (int level = 0; level < maxHeight; level++)
+    {
+        head->forward(level) = tail;
+    }
+    tail->previous = head;
+    count = 0;
+    levels = 1;
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::iterator SortedList<T, Compare>::first() const
+{
+    return iterator(head->next);
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::iterator SortedList<T, Compare>::last() const
+{
+    return iterator(tail->previous);
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::iterator SortedList<T, Compare>::insert(const T &x)
+{
+    Node *update[maxHeight];
+    descend([this, &x](const T &value) { return !comp(x, value); }, update);
+
+    int height = randomHeight();
+    Node *node = allocateNode(height);
+    try
+    {
+        new (node->storage) T(x);
+    }
+    catch (...)
+    {
+        freeNode(node);
+        throw;
+    }
+
+    for (int level = levels; level < height; level++)
+    {
+        update[level] = head;
+    }
+    for (int level = 0; level < height; level++)
+    {
+        node->forward(level) = update[level]->forward(level);
+        update[level]->forward(level) = node;
+    }
+    node->previous = update[0];
+    node->next->previous = node;
+    levels = std::max(levels, height);
+    count++;
+    return iterator(node);
+}
+
+template <typename T, typename Compare>
+bool SortedList<T, Compare>::erase(const T &x)
+{
+    // Every node on a level is also on level 0, so the first element not less than x on level 0
+    // is also the first one on each level of its own tower: `update` already holds its predecessors
+    Node *update[maxHeight];
+    Node *node = descend([this, &x](const T &value) { return comp(value, x); }, update)->next;
+    if (node == tail || comp(x, *node->value()))
+    {
+        return false;
+    }
+    eraseNode(node, update);
+    return true;
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::iterator SortedList<T, Compare>::erase(iterator position)
+{
+    if (position.isPastEnd() || position.isPastBeginning())
+    {
+        throw std::invalid_argument("Cannot erase a dummy head or tail node.");
+    }
+
+    // Descend to the elements equal to the one erased, then step over the equal ones that precede it
+    // on each level of its tower
+    Node *node = position.current;
+    const T &x = *node->value();
+    Node *update[maxHeight];
+    Node *before = head;
+    for (int level = levels - 1; level >= 0; level--)
+    {
+        Node *next = before->forward(level);
+        while (next != tail && comp(*next->value(), x))
+        {
+            before = next;
+            next = before->forward(level);
+        }
+        if (level < node->height)
+        {
+            while (next != node)
+            {
+                before = next;
+                next = before->forward(level);
+            }
+            update[level] = before;
+        }
+    }
+
+    Node *next = node->next;
+    eraseNode(node, update);
+    return iterator(next);
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::iterator SortedList<T, Compare>::lowerBound(const T &x) const
+{
+    return iterator(descend([this, &x](const T &value) { return comp(value, x); }, nullptr)->next);
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::iterator SortedList<T, Compare>::upperBound(const T &x) const
+{
+    return iterator(descend([this, &x](const T &value) { return !comp(x, value); }, nullptr)->next);
+}
+
+template <typename T, typename Compare>
+bool SortedList<T, Compare>::contains(const T &x) const
+{
+    iterator itr = lowerBound(x);
+    return !itr.isPastEnd() && !comp(x, *itr);
+}
+
+template <typename T, typename Compare>
+SortedListRange<T> SortedList<T, Compare>::range(const T &lo, const T &hi) const
+{
+    iterator from = lowerBound(lo);
+    if (!comp(lo, hi))
+    {
+        return SortedListRange<T>(from, from);
+    }
+
+    // hi is usually close to lo, so walking level 0 from `from` beats a second descent until the walk gets long
+    iterator to = from;
+    for (int steps = 0; !to.isPastEnd() && comp(*to, hi); steps++, ++to)
+    {
+        if (steps == 2 * maxHeight)
+        {
+            to = lowerBound(hi);
+            break;
+        }
+    }
+    return SortedListRange<T>(from, to);
+}
+
+template <typename T, typename Compare>
+int SortedList<T, Compare>::size() const
+{
+    return count;
+}
+
+template <typename T, typename Compare>
+void SortedList<T, Compare>::print(std::ostream &os, bool forward) const
+{
+    if (forward)
+    {
+        for (iterator itr = first(); !itr.isPastEnd(); itr.moveForward())
+        {
+            os << itr.retrieve() << " ";
+        }
+    }
+    else
+    {
+        for (iterator itr = last(); !itr.isPastBeginning(); itr.moveBackward())
+        {
+            os << itr.retrieve() << " ";
+        }
+    }
+    os << std::endl;
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::iterator SortedList<T, Compare>::begin() const
+{
+    return first();
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::iterator SortedList<T, Compare>::end() const
+{
+    return iterator(tail);
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::reverse_iterator SortedList<T, Compare>::rbegin() const
+{
+    return reverse_iterator(end());
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::reverse_iterator SortedList<T, Compare>::rend() const
+{
+    return reverse_iterator(begin());
+}
+
+template <typename T, typename Compare>
+typename SortedList<T, Compare>::Node *SortedList<T, Compare>::allocateNode(int height)
+{
+    std::size_t skipCount = static_cast<std::size_t>(height - 1);
+    void *memory = ::operator new(sizeof(Node) + skipCount * sizeof(Node *));
+    Node *node = new (memory) Node;
+    Node **skips = reinterpret_cast<Node **>(static_cast<unsigned char *>(memory) + sizeof(Node));
+    for (std::size_t level = 0; level < skipCount; level++)
+    {
+        new (&skips[level]) Node *(nullptr);
+    }
+    node->next = nullptr;
+    node->previous = nullptr;
+    node->height = height;
+    return node;
+}
+
+template <typename T, typename Compare>
+void SortedList<T, Compare>::freeNode(Node *node)
+{
+    ::operator delete(static_cast<void *>(node));
+}
+
+template <typename T, typename Compare>
+int SortedList<T, Compare>::randomHeight()
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    std::uint32_t bits = seed;
+    int height = 1;
+    while (height < maxHeight && (bits & 3u) == 0)
+    {
+        height++;
+        bits >>= 2;
+    }
+    return height;
+}
+
+template <typename T, typename Compare>
+template <typename Before>
+typename SortedList<T, Compare>::Node *SortedList<T, Compare>::descend(Before before, Node **update) const
+{
+    Node *node = head;
+    for (int level = levels - 1; level >= 0; level--)
+    {
+        Node *next = node->forward(level);
+        while (next != tail && before(*next->value()))
+        {
+            node = next;
+            next = node->forward(level);
+        }
+        if (update != nullptr)
+        {
+            update[level] = node;
+        }
+    }
+    return node;
+}
+
+template <typename T, typename Compare>
+void SortedList<T, Compare>::eraseNode(Node *node, Node **update)
+{
+    for (int level = 0; level < node->height; level++)
+    {
+        update[level]->forward(level) = node->forward(level);
+    }
+    node->next->previous = node->previous;
+    node->value()->~T();
+    freeNode(node);
+    count--;
+    while (levels > 1 && head->forward(levels - 1) == tail)
+    {
+        levels--;
+    }
+}
+
+template <typename T, typename Compare>
+void SortedList<T, Compare>::copyNodes(const SortedList<T, Compare> &source)
+{
+    Node *last[maxHeight];
+    std::fill(last, last + maxHeight, head);
+    try
+    {
+        for (Node *from = source.head->next; from != source.tail; from = from->next)
+        {
+            Node *node = allocateNode(randomHeight());
+            try
+            {
+                new (node->storage) T(*from->value());
+            }
+            catch (...)
+            {
+                freeNode(node);
+                throw;
+            }
+            node->previous = last[0];
+            for (int level = 0; level < node->height; level++)
+            {
+                last[level]->forward(level) = node;
+                last[level] = node;
+            }
+            levels = std::max(levels, node->height);
+            count++;
+        }
+    }
+    catch (...)
+    {
+        closeLevels(last);
+        throw;
+    }
+    closeLevels(last);
+}
+
+template <typename T, typename Compare>
+void SortedList<T, Compare>::closeLevels(Node **last)
+{
+    for (int level = 0; level < maxHeight; level++)
+    {
+        last[level]->forward(level) = tail;
+    }
+    tail->previous = last[0];
+}
+
+template <typename T, typename Compare>
+void SortedList<T, Compare>::takeNodes(SortedList<T, Compare> &source)
+{
+    std::swap(head, source.head);
+    std::swap(tail, source.tail);
+    std::swap(count, source.count);
+    std::swap(levels, source.levels);
+}
+
+#endif
@@ -0,0 +1,1065 @@
+#ifndef UNROLLEDLIST_H
+#define UNROLLEDLIST_H
+
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "Prefetch.h"
+
+template <typename T, std::size_t N>
+class UnrolledList;
+
+/**
+ * @brief Default number of elements per chunk: enough to fill a 256-byte (four cache line) chunk.
+ */
+template <typename T>
+constexpr std::size_t unrolledDefaultCapacity()
+{
+    return (256 - 3 * sizeof(void *)) / sizeof(T) >= 2 ? (256 - 3 * sizeof(void *)) / sizeof(T) : 2;
+}
+
+/**
+ * @class UnrolledListNode
+ * @brief A cache-line-aligned chunk of an UnrolledList holding up to N elements in a contiguous array.
+ *
+ * The elements occupy slots [0, used) of the array; the remaining slots are raw storage.
+ * The dummy head and tail chunks of a list never hold elements.
+ */
+template <typename T, std::size_t N>
+class alignas(64) UnrolledListNode
+{
+public:
+    /**
+     * @brief Default constructor.
+     *
+     * Constructs an empty, unlinked chunk.
+     */
+    UnrolledListNode();
+
+    /**
+     * @brief Destructor.
+     *
+     * Destroys the elements held in the chunk.
+     */
+    ~UnrolledListNode();
+
+    UnrolledListNode(const UnrolledListNode &) = delete;
+    UnrolledListNode &operator=(const UnrolledListNode &) = delete;
+
+private:
+    /**
+     * @brief Returns the element slot at `index`.
+     *
+     * @param index The slot index, in [0, N).
+     * @return Pointer to the slot.
+     */
+    T *at(std::size_t index);
+
+    UnrolledListNode *next;                          /**< Pointer to the next chunk in the list. */
+    UnrolledListNode *previous;                      /**< Pointer to the previous chunk in the list. */
+    std::size_t used;                                /**< Number of elements stored in the chunk. */
+    alignas(T) unsigned char storage[N * sizeof(T)]; /**< Element slots. */
+
+    template <typename, std::size_t, bool>
+    friend class UnrolledListItr;    /**< UnrolledListItr needs access to the elements and links. */
+    friend class UnrolledList<T, N>; /**< UnrolledList needs access to the elements and links. */
+};
+
+/**
+ * @class UnrolledListItr
+ * @brief Position in an UnrolledList: a chunk plus an index into it.
+ *
+ * Offers both the ListItr vocabulary (moveForward, retrieve, isPastEnd, ...) and the standard
+ * bidirectional iterator operators, so it is also the `iterator`/`const_iterator` of UnrolledList.
+ * Because chunks shift, split and merge, inserting into or removing from a chunk invalidates
+ * positions in that chunk and its neighbours.
+ */
+template <typename T, std::size_t N, bool IsConst = false>
+class UnrolledListItr
+{
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::conditional<IsConst, const T *, T *>::type;
+    using reference = typename std::conditional<IsConst, const T &, T &>::type;
+
+    /**
+     * @brief Default constructor.
+     *
+     * Constructs an UnrolledListItr pointing to nullptr.
+     */
+    UnrolledListItr();
+
+    /**
+     * @brief Constructor for a given chunk and index.
+     *
+     * @param theNode The chunk to point into.
+     * @param theIndex The index of the element inside the chunk.
+     */
+    UnrolledListItr(UnrolledListNode<T, N> *theNode, std::size_t theIndex);
+
+    /**
+     * @brief Converts a mutable position into a read-only one.
+     *
+     * @param other The position to convert.
+     */
+    template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+    UnrolledListItr(const UnrolledListItr<T, N, OtherConst> &other);
+
+    /**
+     * @brief Checks if the iterator is past the end position (on the dummy tail chunk).
+     *
+     * @return True if the iterator is past the end position, false otherwise.
+     */
+    bool isPastEnd() const;
+
+    /**
+     * @brief Checks if the iterator is past the beginning position (on the dummy head chunk).
+     *
+     * @return True if the iterator is past the beginning position, false otherwise.
+     */
+    bool isPastBeginning() const;
+
+    /**
+     * @brief Advances to the next element, unless already past the end.
+     */
+    void moveForward();
+
+    /**
+     * @brief Moves back to the previous element, unless already past the beginning.
+     */
+    void moveBackward();
+
+    /**
+     * @brief Retrieves the value at the current position.
+     *
+     * @return Reference to the value at the current position.
+     */
+    reference retrieve() const;
+
+    /** @brief Standard iterator access to the value at the current position, without checks. */
+    reference operator*() const;
+    pointer operator->() const;
+
+    /** @brief Standard iterator movement, without bounds checks. */
+    UnrolledListItr &operator++();
+    UnrolledListItr operator++(int);
+    UnrolledListItr &operator--();
+    UnrolledListItr operator--(int);
+
+    /** @brief Checks whether two iterators point to the same element. */
+    template <bool OtherConst>
+    bool operator==(const UnrolledListItr<T, N, OtherConst> &other) const;
+
+    /** @brief Checks whether two iterators point to different elements. */
+    template <bool OtherConst>
+    bool operator!=(const UnrolledListItr<T, N, OtherConst> &other) const;
+
+private:
+    UnrolledListNode<T, N> *current; /**< Chunk holding the position. */
+    std::size_t index;               /**< Index of the element inside the chunk. */
+
+    friend class UnrolledList<T, N>;               /**< UnrolledList needs access to the position. */
+    friend class UnrolledListItr<T, N, !IsConst>; /**< Conversions and comparisons need access. */
+};
+
+/**
+ * @class UnrolledList
+ * @brief Doubly linked list of chunks, each holding up to N elements contiguously.
+ *
+ * Offers the insert/remove/find/iterate API of List with far fewer pointers per element and a
+ * cache-friendly traversal. A chunk that overflows is split in two; a chunk that drops below half
+ * full is merged with its successor when they fit together. Like List, it has a dummy head and tail.
+ */
+template <typename T, std::size_t N = unrolledDefaultCapacity<T>()>
+class UnrolledList
+{
+    static_assert(N >= 2, "An unrolled list needs room for at least two elements per chunk.");
+
+public:
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = UnrolledListItr<T, N>;
+    using const_iterator = UnrolledListItr<T, N, true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /**
+     * @brief Default constructor.
+     *
+     * Sets up the dummy head and tail chunks.
+     */
+    UnrolledList();
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param source The source UnrolledList to be copied.
+     */
+    UnrolledList(const UnrolledList &source);
+
+    /**
+     * @brief Move constructor.
+     *
+     * Takes over the chunks of `source`, leaving it a working empty list.
+     * @param source The source UnrolledList to be moved from.
+     */
+    UnrolledList(UnrolledList &&source);
+
+    /**
+     * @brief Destructor.
+     */
+    ~UnrolledList();
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * @param source The right-hand-side UnrolledList to be copied.
+     * @return Reference to the current list.
+     */
+    UnrolledList &operator=(const UnrolledList &source);
+
+    /**
+     * @brief Move assignment operator.
+     *
+     * @param source The right-hand-side UnrolledList to be moved from.
+     * @return Reference to the current list.
+     */
+    UnrolledList &operator=(UnrolledList &&source);
+
+    /**
+     * @brief Checks if the list is empty.
+     *
+     * @return True if the list is empty, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Removes all elements and chunks except the dummy head and tail.
+     */
+    void makeEmpty();
+
+    /**
+     * @brief Returns an iterator to the first element (past the end if the list is empty).
+     *
+     * @return UnrolledListItr pointing to the first element.
+     */
+    iterator first();
+
+    /**
+     * @brief Returns an iterator to the last element (past the beginning if the list is empty).
+     *
+     * @return UnrolledListItr pointing to the last element.
+     */
+    iterator last();
+
+    /**
+     * @brief Inserts a value after the given position.
+     *
+     * @param x The value to be inserted.
+     * @param position The position to insert after.
+     */
+    void insertAfter(const T &x, iterator position);
+
+    /**
+     * @brief Inserts a value before the given position.
+     *
+     * @param x The value to be inserted.
+     * @param position The position to insert before.
+     */
+    void insertBefore(const T &x, iterator position);
+
+    /**
+     * @brief Inserts a value at the tail of the list.
+     *
+     * @param x The value to be inserted.
+     */
+    void insertAtTail(const T &x);
+
+    /**
+     * @brief Inserts a value at the front of the list.
+     *
+     * @param x The value to be inserted.
+     */
+    void insertAtFront(const T &x);
+
+    /**
+     * @brief Returns an iterator to the first occurrence of a value, or past the end if it is not found.
+     *
+     * @param x The value to search for.
+     * @return UnrolledListItr pointing to the first occurrence of the value.
+     */
+    iterator find(const T &x);
+
+    /**
+     * @brief Returns an iterator to the first element for which `pred` returns true, or past the end.
+     *
+     * Like every traversal kernel below, it prefetches the whole next chunk while the current one is scanned.
+     * @param pred Unary predicate taking a const T&.
+     * @return UnrolledListItr pointing to the first match.
+     */
+    template <typename Predicate>
+    iterator findIf(Predicate pred);
+
+    /**
+     * @brief Counts the elements equal to a value.
+     *
+     * @param x The value to count.
+     * @return The number of elements equal to `x`.
+     */
+    int occurrences(const T &x) const;
+
+    /**
+     * @brief Counts the elements for which `pred` returns true.
+     *
+     * @param pred Unary predicate taking a const T&.
+     * @return The number of matching elements.
+     */
+    template <typename Predicate>
+    int countIf(Predicate pred) const;
+
+    /**
+     * @brief Calls `f` on every element, from first to last.
+     *
+     * @param f Function object taking a T&; it may modify the element but not the list.
+     * @return `f`, after the last call.
+     */
+    template <typename Function>
+    Function forEach(Function f);
+
+    /**
+     * @brief Folds the elements from first to last with `op`, like std::accumulate.
+     *
+     * @param init The initial value.
+     * @param op Binary operation taking the running value and a const T&.
+     * @return The folded value.
+     */
+    template <typename U, typename BinaryOperation = std::plus<>>
+    U accumulate(U init, BinaryOperation op = BinaryOperation()) const;
+
+    /**
+     * @brief Removes the first occurrence of a value from the list.
+     *
+     * @param x The value to be removed.
+     */
+    void remove(const T &x);
+
+    /**
+     * @brief Returns the number of elements in the list.
+     *
+     * @return The number of elements in the list.
+     */
+    int size() const;
+
+    /**
+     * @brief Returns the number of chunks in use, excluding the dummy head and tail.
+     *
+     * @return The number of chunks.
+     */
+    int chunkCount() const;
+
+    /**
+     * @brief Prints the contents of the list forwards (head -> tail) or backwards (tail -> head).
+     *
+     * @param os The output stream to which the list is printed.
+     * @param forward True to print forwards, false to print backwards.
+     */
+    void print(std::ostream &os = std::cout, bool forward = true);
+
+    /** @brief Standard iterator access, as on List; end() is the dummy tail chunk. */
+    iterator begin();
+    const_iterator begin() const;
+    iterator end();
+    const_iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    reverse_iterator rbegin();
+    const_reverse_iterator rbegin() const;
+    reverse_iterator rend();
+    const_reverse_iterator rend() const;
+
+private:
+    using Node = UnrolledListNode<T, N>;
+
+    /**
+     * @brief Allocates an empty chunk and links it after `previous`.
+     *
+     * @param previous The chunk to link after.
+     * @return The new chunk.
+     */
+    Node *insertChunkAfter(Node *previous);
+
+    /**
+     * @brief Unlinks and frees a chunk.
+     *
+     * @param node The chunk to free.
+     */
+    void unlinkChunk(Node *node);
+
+    /**
+     * @brief Inserts `x` at slot `index` of `node`, splitting the chunk if it is full.
+     *
+     * @param node The chunk to insert into; must not be a dummy chunk.
+     * @param index The slot, in [0, node->used].
+     * @param x The value to be inserted.
+     */
+    void insertInto(Node *node, std::size_t index, const T &x);
+
+    /**
+     * @brief Removes the element at slot `index` of `node`, merging chunks that fall below half full.
+     *
+     * @param node The chunk to remove from.
+     * @param index The slot of the element.
+     */
+    void eraseFrom(Node *node, std::size_t index);
+
+    /**
+     * @brief Moves every chunk of `source` to the end of this list without copying values.
+     *
+     * @param source The list whose chunks are taken; it is left empty.
+     */
+    void takeChunks(UnrolledList &source);
+
+    /**
+     * @brief Calls `visit` on each element from first to last until it returns true.
+     *
+     * The next chunk's address is known as soon as a chunk is reached, so all of its cache lines are
+     * prefetched before the current chunk's elements are visited.
+     * @param visit Function object taking a T& and returning true to stop.
+     * @param index Receives the slot `visit` stopped at.
+     * @return The chunk `visit` stopped in, or the dummy tail.
+     */
+    template <typename Visitor>
+    Node *scanElements(Visitor visit, std::size_t &index) const;
+
+    Node *head; // Dummy chunk representing the beginning of the list
+    Node *tail; // Dummy chunk representing the end of the list
+    int count;  // Number of elements in the list
+    int chunks; // Number of chunks between head and tail
+};
+
+template <typename T, std::size_t N>
+UnrolledListNode<T, N>::UnrolledListNode()
+{
+    next = nullptr;
+    previous = nullptr;
+    used = 0;
+}
+
+template <typename T, std::size_t N>
+UnrolledListNode<T, N>::~UnrolledListNode()
+{
+    for (std::size_t i = 0; i < used; i++)
+    {
+        at(i)->~T();
+    }
+}
+
+template <typename T, std::size_t N>
+T *UnrolledListNode<T, N>::at(std::size_t index)
+{
+    return std::launder(reinterpret_cast<T *>(storage) + index);
+}
+
+template <typename T, std::size_t N, bool IsConst>
+UnrolledListItr<T, N, IsConst>::UnrolledListItr()
+{
+    current = nullptr;
+    index = 0;
+}
+
+template <typename T, std::size_t N, bool IsConst>
+UnrolledListItr<T, N, IsConst>::UnrolledListItr(UnrolledListNode<T, N> *theNode, std::size_t theIndex)
+{
+    current = theNode;
+    index = theIndex;
+}
+
+template <typename T, std::size_t N, bool IsConst>
+template <bool OtherConst, typename>
+UnrolledListItr<T, N, IsConst>::UnrolledListItr(const UnrolledListItr<T, N, OtherConst> &other)
+{
+    current = other.current;
+    index = other.index;
+}
+
+template <typename T, std::size_t N, bool IsConst>
+bool UnrolledListItr<T, N, IsConst>::isPastEnd() const
+{
+    return current->next == nullptr;
+}
+
+template <typename T, std::size_t N, bool IsConst>
+bool UnrolledListItr<T, N, IsConst>::isPastBeginning() const
+{
+    return current->previous == nullptr;
+}
+
+template <typename T, std::size_t N, bool IsConst>
+void UnrolledListItr<T, N, IsConst>::moveForward()
+{
+    if (current != nullptr && !isPastEnd())
+    {
+        ++*this;
+    }
+}
+
+template <typename T, std::size_t N, bool IsConst>
+void UnrolledListItr<T, N, IsConst>::moveBackward()
+{
+    if (current != nullptr && !isPastBeginning())
+    {
+        --*this;
+    }
+}
+
+template <typename T, std::size_t N, bool IsConst>
+typename UnrolledListItr<T, N, IsConst>::reference UnrolledListItr<T, N, IsConst>::retrieve() const
+{
+    if (current == nullptr || current->used == 0)
+    {
+        throw std::runtime_error("Attempt to retrieve from a position without an element");
+    }
+    return *current->at(index);
+}
+
+template <typename T, std::size_t N, bool IsConst>
+typename UnrolledListItr<T, N, IsConst>::reference UnrolledListItr<T, N, IsConst>::operator*() const
+{
+    return *current->at(index);
+}
+
+template <typename T, std::size_t N, bool IsConst>
+typename UnrolledListItr<T, N, IsConst>::pointer UnrolledListItr<T, N, IsConst>::operator->() const
+{
+    return current->at(index);
+}
+
+template <typename T, std::size_t N, bool IsConst>
+UnrolledListItr<T, N, IsConst> &UnrolledListItr<T, N, IsConst>::operator++()
+{
+    if (++index >= current->used)
+    {
+        current = current->next;
+        index = 0;
+    }
+    return *this;
+}
+
+template <typename T, std::size_t N, bool IsConst>
+UnrolledListItr<T, N, IsConst> UnrolledListItr<T, N, IsConst>::operator++(int)
+{
+    UnrolledListItr<T, N, IsConst> old = *this;
+    ++*this;
+    return old;
+}
+
+template <typename T, std::size_t N, bool IsConst>
+UnrolledListItr<T, N, IsConst> &UnrolledListItr<T, N, IsConst>::operator--()
+{
+    if (index == 0)
+    {
+        current = current->previous;
+        index = current->used == 0 ? 0 : current->used - 1;
+    }
+    else
+    {
+        index--;
+    }
+    return *this;
+}
+
+template <typename T, std::size_t N, bool IsConst>
+UnrolledListItr<T, N, IsConst> UnrolledListItr<T, N, IsConst>::operator--(int)
+{
+    UnrolledListItr<T, N, IsConst> old = *this;
+    --*this;
+    return old;
+}
+
+template <typename T, std::size_t N, bool IsConst>
+template <bool OtherConst>
+bool UnrolledListItr<T, N, IsConst>::operator==(const UnrolledListItr<T, N, OtherConst> &other) const
+{
+    return current == other.current && index == other.index;
+}
+
+template <typename T, std::size_t N, bool IsConst>
+template <bool OtherConst>
+bool UnrolledListItr<T, N, IsConst>::operator!=(const UnrolledListItr<T, N, OtherConst> &other) const
+{
+    return !(*this == other);
+}
+
+template <typename T, std::size_t N>
+UnrolledList<T, N>::UnrolledList()
+{
+    head = new Node();
+    tail = new Node();
+    head->next = tail;
+    tail->previous = head;
+    count = 0;
+    chunks = 0;
+}
+
+template <typename T, std::size_t N>
+UnrolledList<T, N>::UnrolledList(const UnrolledList<T, N> &source) : UnrolledList()
+{
+    for (const T &value : source)
+    {
+        insertAtTail(value);
+    }
+}
+
+template <typename T, std::size_t N>
+UnrolledList<T, N>::UnrolledList(UnrolledList<T, N> &&source) : UnrolledList()
+{
+    takeChunks(source);
+}
+
+template <typename T, std::size_t N>
+UnrolledList<T, N>::~UnrolledList()
+{
+    makeEmpty();
+    delete tail;
+    delete head;
+}
+
+template <typename T, std::size_t N>
+UnrolledList<T, N> &UnrolledList<T, N>::operator=(const UnrolledList<T, N> &source)
+{
+    if (this != &source)
+    {
+        makeEmpty();
+        for (const T &value : source)
+        {
+            insertAtTail(value);
+        }
+    }
+    return *this;
+}
+
+template <typename T, std::size_t N>
+UnrolledList<T, N> &UnrolledList<T, N>::operator=(UnrolledList<T, N> &&source)
+{
+    if (this != &source)
+    {
+        makeEmpty();
+        takeChunks(source);
+    }
+    return *this;
+}
+
+template <typename T, std::size_t N>
+bool UnrolledList<T, N>::isEmpty() const
+{
+    return count == 0;
+}
+
+template <typename T, std::size_t N>
+void UnrolledList<T, N>::makeEmpty()
+{
+    Node *node = head->next;
+    while (node != tail)
+    {
+        Node *next = node->next;
+        delete node;
+        node = next;
+    }
+    head->next = tail;
+    tail->previous = head;
+    count = 0;
+    chunks = 0;
+}
+
+template <typename T, std::size_t N>
+typename UnrolledList<T, N>::iterator UnrolledList<T, N>::first()
+{
+    return iterator(head->next, 0);
+}
+
+template <typename T, std::size_t N>
+typename UnrolledList<T, N>::iterator UnrolledList<T, N>::last()
+{
+    Node *node = tail->previous;
+    return iterator(node, node->used == 0 ? 0 : node->used - 1);
+}
+
+template <typename T, std::size_t N>
+void UnrolledList<T, N>::insertAfter(const T &x, iterator position)
+{
+    if (position.isPastEnd())
+    {
+        throw std::invalid_argument("Cannot insert after the end of the list.");
+    }
+
+    if (position.isPastBeginning())
+    {
+        insertAtFront(x);
+    }
+    else
+    {
+        insertInto(position.current, position.index + 1, x);
+    }
+}
+
+template <typename T, std::size_t N>
+void UnrolledList<T, N>::insertBefore(const T &x, iterator position)
+{
+    if (position.isPastBeginning())
+    {
+        throw std::invalid_argument("Cannot insert before the beginning of the list.");
+    }
+
+    if (position.isPastEnd())
+    {
+        insertAtTail(x);
+    }
+    else
+    {
+        insertInto(position.current, position.index, x);
+    }
+}
+
+template <typename T, std::size_t N>
+void UnrolledList<T, N>::insertAtTail(const T &x)
+{
+    Node *node = tail->previous;
+    if (node == head || node->used == N)
+    {
+        node = insertChunkAfter(node);
+    }
+    insertInto(node, node->used, x);
+}
+
+template <typename T, std::size_t N>
+void UnrolledList<T, N>::insertAtFront(const T &x)
+{
+    Node *node = head->next;
+    if (node == tail || node->used == N)
+    {
+        node = insertChunkAfter(head);
+    }
+    insertInto(node, 0, x);
+}
+
+template <typename T, std::size_t N>
+typename UnrolledList<T, N>::iterator UnrolledList<T, N>::find(const T &x)
+{
+    std::size_t index;
+    Node *node = scanElements([&x](T &value) { return value == x; }, index);
+    return iterator(node, index);
+}
+
+template <typename T, std::size_t N>
+template <typename Predicate>
+typename UnrolledList<T, N>::iterator UnrolledList<T, N>::findIf(Predicate pred)
+{
+    std::size_t index;
+    Node *node = scanElements([&pred](T &value) { return static_cast<bool>(pred(static_cast<const T &>(value))); },
+                              index);
+    return iterator(node, index);
+}
+
+template <typename T, std::size_t N>
+int UnrolledList<T, N>::occurrences(const T &x) const
+{
+    return countIf([&x](const T &value) { return value == x; });
+}
+
+template <typename T, std::size_t N>
+template <typename Predicate>
+int UnrolledList<T, N>::countIf(Predicate pred) const
+{
+    int matches = 0;
+    std::size_t index;
+    scanElements(
+        [&](T &value) {
+            if (pred(static_cast<const T &>(value)))
+            {
+                matches++;
+            }
+            return false;
+        },
+        index);
+    return matches;
+}
+
+template <typename T, std::size_t N>
+template <typename Function>
+Function UnrolledList<T, N>::forEach(Function f)
+{
+    std::size_t index;
+    scanElements(
+        [&f](T &value) {
+            f(value);
+            return false;
+        },
+        index);
+    return f;
+}
+
+template <typename T, std::size_t N>
+template <typename U, typename BinaryOperation>
+U UnrolledList<T, N>::accumulate(U init, BinaryOperation op) const
+{
+    std::size_t index;
+    scanElements(
+        [&](T &value) {
+            init = op(std::move(init), static_cast<const T &>(value));
+            return false;
+        },
+        index);
+    return init;
+}
+
+template <typename T, std::size_t N>
+void UnrolledList<T, N>::remove(const T &x)
+{
+    iterator position = find(x);
+    if (!position.isPastEnd())
+    {
+        eraseFrom(position.current, position.index);
+    }
+}
+
+template <typename T, std::size_t N>
+int UnrolledList<T, N>::size() const
+{
+    return count;
+}
+
+template <typename T, std::size_t N>
+int UnrolledList<T, N>::chunkCount() const
+{
+    return chunks;
+}
+
+template <typename T, std::size_t N>
+void UnrolledList<T, N>::print(std::ostream &os, bool forward)
+{
+    if (forward)
+    {
+        for (iterator itr = first(); !itr.isPastEnd(); itr.moveForward())
+        {
+            os << itr.retrieve() << " ";
+        }
+    }
+    else
+    {
+        for (iterator itr = last(); !itr.isPastBeginning(); itr.moveBackward())
+        {
+            os << itr.retrieve() << " ";
+        }
+    }
+    os << std::endl;
+}
+
+template <typename T, std::size_t N>
+typename UnrolledList<T, N>::iterator UnrolledList<T, N>::begin()
+{
+    return iterator(head->next, 0);
+}
+
+template <typename T, std::size_t N>
+typename UnrolledList<T, N>::const_iterator UnrolledList<T, N>::begin() const
+{
+    return const_iterator(head->next, 0);
+}
+
+template <typename T, std::size_t N>
+typename UnrolledList<T, N>::iterator UnrolledList<T, N>::end()
+{
+    return iterator(tail, 0);
+}
+
+template <typename T, std::size_t N>
+typename UnrolledList<T, N>::const_iterator UnrolledList<T, N>::end() const
+{
+    return const_iterator(tail, 0);
+}
+
+template <typename T, std::size_t N>
+typename UnrolledList<T, N>::const_iterator UnrolledList<T, N>::cbegin() const
+{
+    return begin();
+}
+
+template <typename T, std::size_t N>
+typename UnrolledList<T, N>::const_iterator UnrolledList<T, N>::cend() const
+{
+    return end();
+}
+
+template <typename T, std::size_t N>
+typename UnrolledList<T, N>::reverse_iterator UnrolledList<T, N>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <typename T, std::size_t N>
+typename UnrolledList<T, N>::const_reverse_iterator UnrolledList<T, N>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <typename T, std::size_t N>
+typename UnrolledList<T, N>::reverse_iterator UnrolledList<T, N>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template <typename T, std::size_t N>
+typename UnrolledList<T, N>::const_reverse_iterator UnrolledList<T, N>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <typename T, std::size_t N>
+typename UnrolledList<T, N>::Node *UnrolledList<T, N>::insertChunkAfter(Node *previous)
+{
+    Node *node = new Node();
+    node->previous = previous;
+    node->next = previous->next;
+    node->next->previous = node;
+    previous->next = node;
+    chunks++;
+    return node;
+}
+
+template <typename T, std::size_t N>
+void UnrolledList<T, N>::unlinkChunk(Node *node)
+{
+    node->previous->next = node->next;
+    node->next->previous = node->previous;
+    delete node;
+    chunks--;
+}
+
+template <typename T, std::size_t N>
+void UnrolledList<T, N>::insertInto(Node *node, std::size_t index, const T &x)
+{
+    T value(x); // `x` may refer to an element that is about to be shifted
+    if (node->used == N)
+    {
+        // Split: move the upper half into a new chunk, then insert into whichever half owns the slot
+        Node *upper = insertChunkAfter(node);
+        std::size_t keep = N / 2;
+        for (std::size_t i = keep; i < N; i++)
+        {
+            new (upper->at(i - keep)) T(std::move(*node->at(i)));
+            node->at(i)->~T();
+        }
+        upper->used = N - keep;
+        node->used = keep;
+
+        if (index > keep)
+        {
+            node = upper;
+            index -= keep;
+        }
+    }
+
+    if (index == node->used)
+    {
+        new (node->at(index)) T(std::move(value));
+    }
+    else
+    {
+        new (node->at(node->used)) T(std::move(*node->at(node->used - 1)));
+        for (std::size_t i = node->used - 1; i > index; i--)
+        {
+            *node->at(i) = std::move(*node->at(i - 1));
+        }
+        *node->at(index) = std::move(value);
+    }
+    node->used++;
+    count++;
+}
+
+template <typename T, std::size_t N>
+void UnrolledList<T, N>::eraseFrom(Node *node, std::size_t index)
+{
+    for (std::size_t i = index + 1; i < node->used; i++)
+    {
+        *node->at(i - 1) = std::move(*node->at(i));
+    }
+    node->at(node->used - 1)->~T();
+    node->used--;
+    count--;
+
+    if (node->used == 0)
+    {
+        unlinkChunk(node);
+        return;
+    }
+
+    // Merge: an underfull chunk absorbs its successor when both fit in one chunk
+    Node *next = node->next;
+    if (node->used < N / 2 && next != tail && node->used + next->used <= N)
+    {
+        for (std::size_t i = 0; i < next->used; i++)
+        {
+            new (node->at(node->used + i)) T(std::move(*next->at(i)));
+        }
+        node->used += next->used;
+        unlinkChunk(next);
+    }
+}
+
+template <typename T, std::size_t N>
+template <typename Visitor>
+typename UnrolledList<T, N>::Node *UnrolledList<T, N>::scanElements(Visitor visit, std::size_t &index) const
+{
+    for (Node *node = head->next; node != tail; node = node->next)
+    {
+        prefetchRangeForRead(node->next, sizeof(Node));
+        T *values = node->at(0);
+        for (std::size_t i = 0; i < node->used; i++)
+        {
+            if (visit(values[i]))
+            {
+                index = i;
+                return node;
+            }
+        }
+    }
+    index = 0;
+    return tail;
+}
+
+template <typename T, std::size_t N>
+void UnrolledList<T, N>::takeChunks(UnrolledList<T, N> &source)
+{
+    if (source.head->next == source.tail)
+    {
+        return;
+    }
+
+    Node *firstNode = source.head->next;
+    Node *lastNode = source.tail->previous;
+    source.head->next = source.tail;
+    source.tail->previous = source.head;
+
+    firstNode->previous = tail->previous;
+    tail->previous->next = firstNode;
+    lastNode->next = tail;
+    tail->previous = lastNode;
+
+    count += source.count;
+    chunks += source.chunks;
+    source.count = 0;
+    source.chunks = 0;
+}
+
+#endif
@@ -0,0 +1,887 @@
+#ifndef XORLIST_H
+#define XORLIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "NodePool.h"
+
+template <typename T>
+class XorList;
+
+/**
+ * @class XorListLink
+ * @brief The single link field of an XorList node: the XOR of the addresses of its two neighbours.
+ *
+ * The dummy head and tail of an XorList are bare links with no value; a missing neighbour counts as address 0.
+ */
+class XorListLink
+{
+public:
+    /**
+     * @brief Default constructor.
+     *
+     * Constructs a link with no neighbours.
+     */
+    XorListLink() : link(0) {}
+
+protected:
+    /**
+     * @brief Returns the neighbour on the other side from `from`.
+     *
+     * @param from One neighbour of this link, or nullptr at the ends of the list.
+     * @return The other neighbour, or nullptr at the ends of the list.
+     */
+    XorListLink *other(const XorListLink *from) const
+    {
+        return reinterpret_cast<XorListLink *>(link ^ reinterpret_cast<std::uintptr_t>(from));
+    }
+
+    /**
+     * @brief Replaces the neighbour `from` with `to`, keeping the other neighbour.
+     *
+     * @param from The neighbour to replace.
+     * @param to The new neighbour.
+     */
+    void replace(const XorListLink *from, const XorListLink *to)
+    {
+        link ^= reinterpret_cast<std::uintptr_t>(from) ^ reinterpret_cast<std::uintptr_t>(to);
+    }
+
+    std::uintptr_t link; /**< Address of the previous node XOR address of the next node. */
+
+    template <typename, bool>
+    friend class XorListItr; /**< XorListItr needs to follow links. */
+    template <typename>
+    friend class XorList;    /**< XorList needs to follow and rewrite links. */
+};
+
+/**
+ * @class XorListNode
+ * @brief A node of an XorList: one link word and the value.
+ */
+template <typename T>
+class XorListNode : public XorListLink
+{
+public:
+    /**
+     * @brief Constructs the value from `args`.
+     *
+     * @param args The arguments forwarded to the constructor of T.
+     */
+    template <typename... Args>
+    explicit XorListNode(Args &&...args);
+
+private:
+    T value; /**< Holds the value. */
+
+    template <typename, bool>
+    friend class XorListItr; /**< XorListItr needs access to the value. */
+    friend class XorList<T>; /**< XorList needs access to the value. */
+};
+
+/**
+ * @class XorListItr
+ * @brief Position in an XorList.
+ *
+ * A single XOR link cannot be followed without knowing where one came from, so a position is a pair of
+ * adjacent links: the current one and the one before it. The XorListItr offers both the ListItr vocabulary
+ * (moveForward, retrieve, isPastEnd, ...) and the standard bidirectional iterator operators.
+ * Because it remembers a neighbour, a position is invalidated when a node is inserted right before it
+ * or when either of its two links is removed; XorList updates the position passed to it.
+ */
+template <typename T, bool IsConst = false>
+class XorListItr
+{
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::conditional<IsConst, const T *, T *>::type;
+    using reference = typename std::conditional<IsConst, const T &, T &>::type;
+
+    /**
+     * @brief Default constructor.
+     *
+     * Constructs an XorListItr pointing to nullptr.
+     */
+    XorListItr();
+
+    /**
+     * @brief Constructor for a position given by two adjacent links.
+     *
+     * @param thePrevious The link before the position, or nullptr at the dummy head.
+     * @param theCurrent The link at the position.
+     */
+    XorListItr(XorListLink *thePrevious, XorListLink *theCurrent);
+
+    /**
+     * @brief Converts a mutable position into a read-only one.
+     *
+     * @param other The position to convert.
+     */
+    template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+    XorListItr(const XorListItr<T, OtherConst> &other);
+
+    /**
+     * @brief Checks if the iterator is past the end position (on the dummy tail).
+     *
+     * @return True if the iterator is past the end position, false otherwise.
+     */
+    bool isPastEnd() const;
+
+    /**
+     * @brief Checks if the iterator is past the beginning position (on the dummy head).
+     *
+     * @return True if the iterator is past the beginning position, false otherwise.
+     */
+    bool isPastBeginning() const;
+
+    /**
+     * @brief Advances to the next element, unless already past the end.
+     */
+    void moveForward();
+
+    /**
+     * @brief Moves back to the previous element, unless already past the beginning.
+     */
+    void moveBackward();
+
+    /**
+     * @brief Retrieves the value at the current position.
+     *
+     * @return Reference to the value at the current position.
+     */
+    reference retrieve() const;
+
+    /**
+     * @brief Returns the value at the current position.
+     *
+     * @return Reference to the value.
+     */
+    reference operator*() const;
+
+    /**
+     * @brief Accesses a member of the value at the current position.
+     *
+     * @return Pointer to the value.
+     */
+    pointer operator->() const;
+
+    /**
+     * @brief Moves to the next node.
+     *
+     * @return Reference to this iterator.
+     */
+    XorListItr &operator++();
+
+    /**
+     * @brief Moves to the next node.
+     *
+     * @return A copy of this iterator from before the move.
+     */
+    XorListItr operator++(int);
+
+    /**
+     * @brief Moves to the previous node.
+     *
+     * @return Reference to this iterator.
+     */
+    XorListItr &operator--();
+
+    /**
+     * @brief Moves to the previous node.
+     *
+     * @return A copy of this iterator from before the move.
+     */
+    XorListItr operator--(int);
+
+    /**
+     * @brief Checks whether two positions are at the same node.
+     *
+     * @param other The position to compare with.
+     * @return True if both are at the same node.
+     */
+    template <bool OtherConst>
+    bool operator==(const XorListItr<T, OtherConst> &other) const;
+
+    /**
+     * @brief Checks whether two positions are at different nodes.
+     *
+     * @param other The position to compare with.
+     * @return True if they are at different nodes.
+     */
+    template <bool OtherConst>
+    bool operator!=(const XorListItr<T, OtherConst> &other) const;
+
+private:
+    XorListLink *previous; /**< The link before the position; nullptr at the dummy head. */
+    XorListLink *current;  /**< The link at the position. */
+
+    friend class XorList<T>;              /**< XorList needs access to the links. */
+    friend class XorListItr<T, !IsConst>; /**< Conversions and comparisons need access to the links. */
+};
+
+/**
+ * @class XorList
+ * @brief Doubly linked list whose nodes store a single `previous XOR next` link instead of two pointers.
+ *
+ * Each node is one pointer-sized link plus the value, and nodes come from a NodePool owned by the list,
+ * so there is no per-node malloc header either: an XorList<int> node takes 16 bytes against 24 bytes for
+ * a ListNode<int> plus the allocator's header. The list still has a dummy head and tail and can be
+ * walked in both directions from either one; the price is that a position must remember its
+ * predecessor (see XorListItr).
+ */
+template <typename T>
+class XorList
+{
+public:
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = XorListItr<T, false>;
+    using const_iterator = XorListItr<T, true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /**
+     * @brief Default constructor.
+     *
+     * Creates an empty list whose dummy head and tail link to each other.
+     */
+    XorList();
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param source The source XorList to be copied.
+     */
+    XorList(const XorList &source);
+
+    /**
+     * @brief Move constructor.
+     *
+     * Takes over the nodes and node pool of `source`; no value is copied. `source` is left as a working empty list.
+     * @param source The source XorList to be moved from.
+     */
+    XorList(XorList &&source);
+
+    /**
+     * @brief Destructor.
+     *
+     * Destroys every value; the node pool then releases the node storage in whole blocks.
+     */
+    ~XorList();
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * @param source The right-hand-side XorList to be copied.
+     * @return Reference to the current list.
+     */
+    XorList &operator=(const XorList &source);
+
+    /**
+     * @brief Move assignment operator.
+     *
+     * @param source The right-hand-side XorList to be moved from.
+     * @return Reference to the current list.
+     */
+    XorList &operator=(XorList &&source);
+
+    /**
+     * @brief Checks if the list is empty.
+     *
+     * @return True if the list is empty, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Removes all items except the dummy head and tail.
+     */
+    void makeEmpty();
+
+    /**
+     * @brief Returns a position at the first element.
+     *
+     * @return XorListItr at the first element, or at the dummy tail if the list is empty.
+     */
+    XorListItr<T> first();
+
+    /**
+     * @brief Returns a position at the last element.
+     *
+     * @return XorListItr at the last element, or at the dummy head if the list is empty.
+     */
+    XorListItr<T> last();
+
+    /**
+     * @brief Inserts a value after the current position.
+     *
+     * `position` stays valid; a position at the element that followed it does not.
+     * @param x The value to be inserted.
+     * @param position The position to insert after.
+     */
+    void insertAfter(const T &x, XorListItr<T> position);
+
+    /**
+     * @brief Inserts a value before the current position.
+     *
+     * `position` is updated so that it stays at the same element.
+     * @param x The value to be inserted.
+     * @param position The position to insert before.
+     */
+    void insertBefore(const T &x, XorListItr<T> &position);
+
+    /**
+     * @brief Inserts a value at the tail of the list.
+     *
+     * @param x The value to be inserted.
+     */
+    void insertAtTail(const T &x);
+
+    /**
+     * @brief Inserts a value at the front of the list.
+     *
+     * @param x The value to be inserted.
+     */
+    void insertAtFront(const T &x);
+
+    /**
+     * @brief Returns a position at the first occurrence of a value.
+     *
+     * @param x The value to search for.
+     * @return XorListItr at the first occurrence, or at the dummy tail if not found.
+     */
+    XorListItr<T> find(const T &x);
+
+    /**
+     * @brief Removes the first occurrence of a value from the list.
+     *
+     * @param x The value to be removed.
+     */
+    void remove(const T &x);
+
+    /**
+     * @brief Removes the element at the current position.
+     *
+     * @param position The position of the element to be removed.
+     * @return XorListItr at the element that followed the removed one.
+     */
+    XorListItr<T> erase(XorListItr<T> position);
+
+    /**
+     * @brief Returns the number of elements in the list.
+     *
+     * @return The number of elements in the list.
+     */
+    int size() const;
+
+    /**
+     * @brief Prints the contents of the list forwards (head -> tail) or backwards (tail -> head).
+     *
+     * @param os The output stream to which the list is printed.
+     * @param forward True to print forwards, false to print backwards.
+     */
+    void print(std::ostream &os = std::cout, bool forward = true);
+
+    /**
+     * @brief Returns the number of bytes each element occupies in the node pool.
+     *
+     * @return The size of one node slot.
+     */
+    static constexpr std::size_t bytesPerNode();
+
+    /**
+     * @brief Returns a standard iterator to the first element.
+     *
+     * @return Iterator at the first element.
+     */
+    iterator begin();
+
+    /**
+     * @brief Returns a standard iterator past the last element.
+     *
+     * @return Iterator at the dummy tail.
+     */
+    iterator end();
+
+    /**
+     * @brief Returns a read-only iterator to the first element.
+     *
+     * @return Iterator at the first element.
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief Returns a read-only iterator past the last element.
+     *
+     * @return Iterator at the dummy tail.
+     */
+    const_iterator end() const;
+
+    /**
+     * @brief Returns a reverse iterator to the last element.
+     *
+     * @return Reverse iterator starting at the last element.
+     */
+    reverse_iterator rbegin();
+
+    /**
+     * @brief Returns a reverse iterator past the first element.
+     *
+     * @return Reverse iterator ending at the dummy head.
+     */
+    reverse_iterator rend();
+
+private:
+    using Node = XorListNode<T>;
+
+    /**
+     * @brief Links a new node holding `x` between two adjacent links.
+     *
+     * @param x The value to be inserted.
+     * @param before The link that will precede the new node.
+     * @param after The link that will follow the new node.
+     * @return The new node.
+     */
+    Node *insertBetween(const T &x, XorListLink *before, XorListLink *after);
+
+    /**
+     * @brief Takes over the nodes and node pool of `source`, relinking its first and last nodes to this list's dummy head and tail.
+     *
+     * This list must be empty; its pool goes to `source`, which is left empty.
+     * @param source The list whose nodes are taken.
+     */
+    void takeNodes(XorList &source);
+
+    XorListLink head;                     // Dummy link before the first element
+    XorListLink tail;                     // Dummy link after the last element
+    int count;                            // Number of elements in the list
+    std::unique_ptr<NodePool<Node>> pool; // Storage for the nodes of this list
+};
+
+template <typename T>
+template <typename... Args>
+XorListNode<T>::XorListNode(Args &&...args) : XorListLink(), value(std::forward<Args>(args)...)
+{
+}
+
+template <typename T, bool IsConst>
+XorListItr<T, IsConst>::XorListItr()
+{
+    previous = nullptr;
+    current = nullptr;
+}
+
+template <typename T, bool IsConst>
+XorListItr<T, IsConst>::XorListItr(XorListLink *thePrevious, XorListLink *theCurrent)
+{
+    previous = thePrevious;
+    current = theCurrent;
+}
+
+template <typename T, bool IsConst>
+template <bool OtherConst, typename>
+XorListItr<T, IsConst>::XorListItr(const XorListItr<T, OtherConst> &other)
+{
+    previous = other.previous;
+    current = other.current;
+}
+
+template <typename T, bool IsConst>
+bool XorListItr<T, IsConst>::isPastEnd() const
+{
+    return current->other(previous) == nullptr && previous != nullptr;
+}
+
+template <typename T, bool IsConst>
+bool XorListItr<T, IsConst>::isPastBeginning() const
+{
+    return previous == nullptr;
+}
+
+template <typename T, bool IsConst>
+void XorListItr<T, IsConst>::moveForward()
+{
+    if (current != nullptr && !isPastEnd())
+    {
+        ++*this;
+    }
+}
+
+template <typename T, bool IsConst>
+void XorListItr<T, IsConst>::moveBackward()
+{
+    if (current != nullptr && !isPastBeginning())
+    {
+        --*this;
+    }
+}
+
+template <typename T, bool IsConst>
+typename XorListItr<T, IsConst>::reference XorListItr<T, IsConst>::retrieve() const
+{
+    if (current == nullptr || isPastEnd() || isPastBeginning())
+    {
+        throw std::runtime_error("Attempt to retrieve from a position without an element");
+    }
+    return static_cast<XorListNode<T> *>(current)->value;
+}
+
+template <typename T, bool IsConst>
+typename XorListItr<T, IsConst>::reference XorListItr<T, IsConst>::operator*() const
+{
+    return static_cast<XorListNode<T> *>(current)->value;
+}
+
+template <typename T, bool IsConst>
+typename XorListItr<T, IsConst>::pointer XorListItr<T, IsConst>::operator->() const
+{
+    return &static_cast<XorListNode<T> *>(current)->value;
+}
+
+template <typename T, bool IsConst>
+XorListItr<T, IsConst> &XorListItr<T, IsConst>::operator++()
+{
+    XorListLink *next = current->other(previous);
+    previous = current;
+    current = next;
+    return *this;
+}
+
+template <typename T, bool IsConst>
+XorListItr<T, IsConst> XorListItr<T, IsConst>::operator++(int)
+{
+    XorListItr<T, IsConst> old = *this;
+    ++*this;
+    return old;
+}
+
+template <typename T, bool IsConst>
+XorListItr<T, IsConst> &XorListItr<T, IsConst>::operator--()
+{
+    XorListLink *before = previous->other(current);
+    current = previous;
+    previous = before;
+    return *this;
+}
+
+template <typename T, bool IsConst>
+XorListItr<T, IsConst> XorListItr<T, IsConst>::operator--(int)
+{
+    XorListItr<T, IsConst> old = *this;
+    --*this;
+    return old;
+}
+
+template <typename T, bool IsConst>
+template <bool OtherConst>
+bool XorListItr<T, IsConst>::operator==(const XorListItr<T, OtherConst> &other) const
+{
+    return current == other.current;
+}
+
+template <typename T, bool IsConst>
+template <bool OtherConst>
+bool XorListItr<T, IsConst>::operator!=(const XorListItr<T, OtherConst> &other) const
+{
+    return current != other.current;
+}
+
+template <typename T>
+XorList<T>::XorList() : pool(new NodePool<Node>())
+{
+    head.replace(nullptr, &tail);
+    tail.replace(nullptr, &head);
+    count = 0;
+}
+
+template <typename T>
+XorList<T>::XorList(const XorList<T> &source) : XorList()
+{
+    for (const T &value : source)
+    {
+        insertAtTail(value);
+    }
+}
+
+template <typename T>
+XorList<T>::XorList(XorList<T> &&source) : XorList()
+{
+    takeNodes(source);
+}
+
+template <typename T>
+XorList<T>::~XorList()
+{
+    makeEmpty();
+}
+
+template <typename T>
+XorList<T> &XorList<T>::operator=(const XorList<T> &source)
+{
+    if (this != &source)
+    {
+        makeEmpty();
+        for (const T &value : source)
+        {
+            insertAtTail(value);
+        }
+    }
+    return *this;
+}
+
+template <typename T>
+XorList<T> &XorList<T>::operator=(XorList<T> &&source)
+{
+    if (this != &source)
+    {
+        makeEmpty();
+        takeNodes(source);
+    }
+    return *this;
+}
+
+template <typename T>
+bool XorList<T>::isEmpty() const
+{
+    return count == 0;
+}
+
+template <typename T>
+void XorList<T>::makeEmpty()
+{
+    XorListLink *previous = &head;
+    XorListLink *current = head.other(nullptr);
+    while (current != &tail)
+    {
+        XorListLink *next = current->other(previous);
+        Node *node = static_cast<Node *>(current);
+        node->~Node();
+        pool->deallocate(node);
+        previous = current;
+        current = next;
+    }
+
+    head = XorListLink();
+    tail = XorListLink();
+    head.replace(nullptr, &tail);
+    tail.replace(nullptr, &head);
+    count = 0;
+}
+
+template <typename T>
+XorListItr<T> XorList<T>::first()
+{
+    return XorListItr<T>(&head, head.other(nullptr));
+}
+
+template <typename T>
+XorListItr<T> XorList<T>::last()
+{
+    XorListLink *lastLink = tail.other(nullptr);
+    return XorListItr<T>(lastLink->other(&tail), lastLink);
+}
+
+template <typename T>
+void XorList<T>::insertAfter(const T &x, XorListItr<T> position)
+{
+    if (position.isPastEnd())
+    {
+        throw std::invalid_argument("Cannot insert after the end of the list.");
+    }
+    insertBetween(x, position.current, position.current->other(position.previous));
+}
+
+template <typename T>
+void XorList<T>::insertBefore(const T &x, XorListItr<T> &position)
+{
+    if (position.isPastBeginning())
+    {
+        throw std::invalid_argument("Cannot insert before the beginning of the list.");
+    }
+    position.previous = insertBetween(x, position.previous, position.current);
+}
+
+template <typename T>
+void XorList<T>::insertAtTail(const T &x)
+{
+    insertBetween(x, tail.other(nullptr), &tail);
+}
+
+template <typename T>
+void XorList<T>::insertAtFront(const T &x)
+{
+    insertBetween(x, &head, head.other(nullptr));
+}
+
+template <typename T>
+XorListItr<T> XorList<T>::find(const T &x)
+{
+    XorListItr<T> itr = first();
+    while (!itr.isPastEnd() && *itr != x)
+    {
+        ++itr;
+    }
+    return itr;
+}
+
+template <typename T>
+void XorList<T>::remove(const T &x)
+{
+    XorListItr<T> itr = find(x);
+    if (!itr.isPastEnd())
+    {
+        erase(itr);
+    }
+}
+
+template <typename T>
+XorListItr<T> XorList<T>::erase(XorListItr<T> position)
+{
+    if (position.isPastEnd() || position.isPastBeginning())
+    {
+        throw std::invalid_argument("Cannot erase a dummy head or tail node.");
+    }
+
+    XorListLink *before = position.previous;
+    XorListLink *after = position.current->other(before);
+    before->replace(position.current, after);
+    after->replace(position.current, before);
+
+    Node *node = static_cast<Node *>(position.current);
+    node->~Node();
+    pool->deallocate(node);
+    count--;
+    return XorListItr<T>(before, after);
+}
+
+template <typename T>
+int XorList<T>::size() const
+{
+    return count;
+}
+
+template <typename T>
+void XorList<T>::print(std::ostream &os, bool forward)
+{
+    if (forward)
+    {
+        for (XorListItr<T> itr = first(); !itr.isPastEnd(); itr.moveForward())
+        {
+            os << itr.retrieve() << " ";
+        }
+    }
+    else
+    {
+        for (XorListItr<T> itr = last(); !itr.isPastBeginning(); itr.moveBackward())
+        {
+            os << itr.retrieve() << " ";
+        }
+    }
+    os << std::endl;
+}
+
+template <typename T>
+constexpr std::size_t XorList<T>::bytesPerNode()
+{
+    return sizeof(Node) > sizeof(void *) ? sizeof(Node) : sizeof(void *);
+}
+
+template <typename T>
+typename XorList<T>::iterator XorList<T>::begin()
+{
+    return first();
+}
+
+template <typename T>
+typename XorList<T>::iterator XorList<T>::end()
+{
+    return iterator(tail.other(nullptr), &tail);
+}
+
+template <typename T>
+typename XorList<T>::const_iterator XorList<T>::begin() const
+{
+    XorListLink *dummyHead = const_cast<XorListLink *>(&head);
+    return const_iterator(dummyHead, dummyHead->other(nullptr));
+}
+
+template <typename T>
+typename XorList<T>::const_iterator XorList<T>::end() const
+{
+    XorListLink *dummyTail = const_cast<XorListLink *>(&tail);
+    return const_iterator(dummyTail->other(nullptr), dummyTail);
+}
+
+template <typename T>
+typename XorList<T>::reverse_iterator XorList<T>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <typename T>
+typename XorList<T>::reverse_iterator XorList<T>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template <typename T>
+typename XorList<T>::Node *XorList<T>::insertBetween(const T &x, XorListLink *before, XorListLink *after)
+{
+    Node *storage = pool->allocate();
+    Node *node;
+    try
+    {
+        node = new (storage) Node(x);
+    }
+    catch (...)
+    {
+        pool->deallocate(storage);
+        throw;
+    }
+
+    node->replace(nullptr, before);
+    node->replace(nullptr, after);
+    before->replace(after, node);
+    after->replace(before, node);
+    count++;
+    return node;
+}
+
+template <typename T>
+void XorList<T>::takeNodes(XorList<T> &source)
+{
+    pool.swap(source.pool);
+    if (source.isEmpty())
+    {
+        return;
+    }
+
+    XorListLink *firstLink = source.head.other(nullptr);
+    XorListLink *lastLink = source.tail.other(nullptr);
+    firstLink->replace(&source.head, &head);
+    lastLink->replace(&source.tail, &tail);
+    head = XorListLink();
+    tail = XorListLink();
+    head.replace(nullptr, firstLink);
+    tail.replace(nullptr, lastLink);
+    count = source.count;
+
+    source.head = XorListLink();
+    source.tail = XorListLink();
+    source.head.replace(nullptr, &source.tail);
+    source.tail.replace(nullptr, &source.head);
+    source.count = 0;
+}
+
+#endif
@@ -0,0 +1,137 @@
+#include "../external/doctest/doctest.h"
+#include "../src/CompactList.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+TEST_CASE("CompactList basic operations")
+{
+    CompactList<int> list;
+    CHECK(list.isEmpty());
+    CHECK(list.first().isPastEnd());
+    CHECK(list.last().isPastBeginning());
+
+    list.insertAtTail(20);
+    list.insertAtTail(40);
+    list.insertAtFront(10);
+    list.insertBefore(30, list.find(40));
+    list.insertAfter(50, list.last());
+    CHECK(list.size() == 5);
+    CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{10, 20, 30, 40, 50});
+    CHECK(std::vector<int>(list.rbegin(), list.rend()) == std::vector<int>{50, 40, 30, 20, 10});
+
+    std::ostringstream forward;
+    list.print(forward, true);
+    CHECK(forward.str() == "10 20 30 40 50 \n");
+    std::ostringstream backward;
+    list.print(backward, false);
+    CHECK(backward.str() == "50 40 30 20 10 \n");
+
+    list.remove(30);
+    list.remove(99);
+    CHECK(list.size() == 4);
+    CHECK(list.find(30).isPastEnd());
+
+    CompactListItr<int> itr = list.erase(list.find(20));
+    CHECK(itr.retrieve() == 40);
+    CHECK_THROWS_AS(list.erase(list.end()), std::invalid_argument);
+    CHECK_THROWS_AS(list.insertAfter(1, list.end()), std::invalid_argument);
+    itr = list.first();
+    itr.moveBackward();
+    CHECK(itr.isPastBeginning());
+    CHECK_THROWS_AS(itr.retrieve(), std::runtime_error);
+    CHECK_THROWS_AS(list.insertBefore(1, itr), std::invalid_argument);
+
+    list.makeEmpty();
+    CHECK(list.isEmpty());
+    list.insertAtTail(7);
+    CHECK(list.first().retrieve() == 7);
+}
+
+TEST_CASE("CompactList reuses freed slots and keeps positions across growth")
+{
+    CompactList<int> list;
+    for (int i = 0; i < 10; i++)
+    {
+        list.insertAtTail(i);
+    }
+    std::size_t capacity = list.capacity();
+    for (int round = 0; round < 100; round++)
+    {
+        list.remove(round % 10);
+        list.insertAtTail(round % 10);
+    }
+    CHECK(list.capacity() == capacity);
+    CHECK(list.size() == 10);
+
+    CompactListItr<int> five = list.find(5);
+    for (int i = 10; i < 1000; i++)
+    {
+        list.insertAtTail(i);
+    }
+    CHECK(list.capacity() > capacity);
+    CHECK(five.retrieve() == 5);
+    five.moveForward();
+    CHECK(five.retrieve() == 6);
+}
+
+TEST_CASE("CompactList compaction renumbers into traversal order")
+{
+    CompactList<std::string> list;
+    for (int i = 0; i < 50; i++)
+    {
+        list.insertAtFront(std::to_string(i));
+    }
+    for (int i = 0; i < 50; i += 2)
+    {
+        list.remove(std::to_string(i));
+    }
+    std::vector<std::string> before(list.begin(), list.end());
+
+    list.compact();
+    CHECK(list.capacity() == 27);
+    CHECK(std::vector<std::string>(list.begin(), list.end()) == before);
+    CHECK(std::vector<std::string>(list.rbegin(), list.rend()) == std::vector<std::string>(before.rbegin(), before.rend()));
+    list.insertAtTail("tail");
+    CHECK(list.last().retrieve() == "tail");
+    CHECK(list.size() == 26);
+
+    list.reserve(1000);
+    CHECK(list.capacity() == 1002);
+    CHECK(list.first().retrieve() == "49");
+}
+
+TEST_CASE("CompactList copy and move")
+{
+    CompactList<int> list;
+    for (int i = 1; i <= 6; i++)
+    {
+        list.insertAtTail(i);
+    }
+    list.remove(3);
+
+    CompactList<int> copy(list);
+    copy.insertAtFront(0);
+    CHECK(std::vector<int>(copy.begin(), copy.end()) == std::vector<int>{0, 1, 2, 4, 5, 6});
+    CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{1, 2, 4, 5, 6});
+
+    CompactList<std::string> words;
+    words.insertAtTail("alpha");
+    words.insertAtTail("beta");
+    CompactList<std::string> wordsCopy(words);
+    words.remove("alpha");
+    CHECK(wordsCopy.first().retrieve() == "alpha");
+
+    CompactList<int> moved(std::move(copy));
+    CHECK(copy.isEmpty());
+    CHECK(moved.size() == 6);
+    copy.insertAtTail(9);
+    CHECK(copy.first().retrieve() == 9);
+
+    list = moved;
+    CHECK(list.size() == 6);
+    list = std::move(copy);
+    CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{9});
+    CHECK(moved.last().retrieve() == 6);
+}
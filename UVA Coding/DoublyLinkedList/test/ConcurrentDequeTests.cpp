@@ -0,0 +1,243 @@
+#include "../external/doctest/doctest.h"
+
+#include <functional>
+
+namespace
+{
+thread_local std::function<void()> pauseHook; // Called by a pop between reading a link and its CAS
+}
+
+#define CONCURRENTDEQUE_PAUSE() (pauseHook ? pauseHook() : void())
+#include "../src/ConcurrentDeque.h"
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("ConcurrentDeque behaves as a deque on one thread")
+{
+    ConcurrentDeque<std::string> deque;
+    std::string value;
+    CHECK(deque.isEmpty());
+    CHECK_FALSE(deque.popFront(value));
+    CHECK_FALSE(deque.popBack(value));
+
+    deque.pushBack("b");
+    deque.pushBack("c");
+    deque.pushFront("a");
+    CHECK_FALSE(deque.isEmpty());
+
+    REQUIRE(deque.popFront(value));
+    CHECK(value == "a");
+    REQUIRE(deque.popBack(value));
+    CHECK(value == "c");
+    REQUIRE(deque.popBack(value));
+    CHECK(value == "b");
+    CHECK(deque.isEmpty());
+
+    for (int i = 0; i < 5000; i++)
+    {
+        deque.pushFront(std::to_string(i));
+    }
+    for (int i = 0; i < 5000; i++)
+    {
+        REQUIRE(deque.popBack(value));
+        CHECK(value == std::to_string(i));
+    }
+    CHECK_FALSE(deque.popFront(value));
+
+    deque.pushBack("left for the destructor");
+}
+
+TEST_CASE("ConcurrentDeque loses and duplicates nothing under contention")
+{
+    const int threads = 4;
+    const int perThread = 20000;
+    ConcurrentDeque<long long> deque;
+    std::atomic<long long> poppedSum(0);
+    std::atomic<int> poppedCount(0);
+    std::vector<std::thread> workers;
+
+    for (int t = 0; t < threads; t++)
+    {
+        workers.emplace_back([&, t]() {
+            long long sum = 0;
+            int count = 0;
+            for (int i = 0; i < perThread; i++)
+            {
+                long long value = static_cast<long long>(t) * perThread + i + 1;
+                if (i % 2 == 0)
+                {
+                    deque.pushBack(value);
+                }
+                else
+                {
+                    deque.pushFront(value);
+                }
+
+                long long out;
+                if ((i % 3 == 0 && deque.popFront(out)) || (i % 3 == 1 && deque.popBack(out)))
+                {
+                    sum += out;
+                    count++;
+                }
+            }
+            poppedSum += sum;
+            poppedCount += count;
+        });
+    }
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    long long out;
+    while (deque.popFront(out))
+    {
+        poppedSum += out;
+        poppedCount++;
+    }
+
+    long long total = static_cast<long long>(threads) * perThread;
+    CHECK(poppedCount.load() == total);
+    CHECK(poppedSum.load() == total * (total + 1) / 2);
+}
+
+// Pauses a pop on {1, 2, 3} after it has read the link next to its end, empties the other end down to
+// the paused node, churns that end until a scan recycles the popped nodes, then pushes `pushes` values.
+// Returns the number of values the deque still holds once the pop has finished.
+static int pushesSurvivingPausedPop(bool front, int pushes, int &popped)
+{
+    ConcurrentDeque<int> deque;
+    for (int x : {1, 2, 3})
+    {
+        deque.pushBack(x);
+    }
+
+    std::atomic<int> stage(0);
+    std::thread paused([&]() {
+        pauseHook = [&]() {
+            if (stage.load() == 0)
+            {
+                stage.store(1);
+                while (stage.load() != 2)
+                {
+                    std::this_thread::yield();
+                }
+            }
+        };
+        if (front)
+        {
+            deque.popFront(popped);
+        }
+        else
+        {
+            deque.popBack(popped);
+        }
+        pauseHook = nullptr;
+    });
+    while (stage.load() != 1)
+    {
+        std::this_thread::yield();
+    }
+
+    // The other end is the one the paused pop does not remove from
+    int out;
+    auto pushOther = [&](int x) {
+        if (front)
+        {
+            deque.pushBack(x);
+        }
+        else
+        {
+            deque.pushFront(x);
+        }
+    };
+    auto popOther = [&]() { return front ? deque.popBack(out) : deque.popFront(out); };
+
+    popOther();
+    popOther();
+    for (std::size_t i = 0; i < 4 * ConcurrentDeque<int>::kSlots; i++)
+    {
+        pushOther(0);
+        popOther();
+    }
+    for (int i = 0; i < pushes; i++)
+    {
+        pushOther(100 + i);
+    }
+    stage.store(2);
+    paused.join();
+
+    int remaining = 0;
+    while (deque.popFront(out))
+    {
+        remaining++;
+    }
+    return remaining;
+}
+
+TEST_CASE("ConcurrentDeque pop does not swing a recycled anchor")
+{
+    // Some push count reissues the index of the other end, recreating the anchor word the paused pop read
+    for (bool front : {true, false})
+    {
+        int lost = 0;
+        for (int pushes = 1; pushes <= static_cast<int>(4 * ConcurrentDeque<int>::kSlots) + 8; pushes++)
+        {
+            int popped = 0;
+            int remaining = pushesSurvivingPausedPop(front, pushes, popped);
+            if (popped != (front ? 1 : 3) || remaining != pushes)
+            {
+                lost++;
+            }
+        }
+        CHECK(lost == 0);
+    }
+}
+
+struct ThrowingMove
+{
+    static bool fail;
+    int value;
+
+    ThrowingMove(int v) : value(v) {}
+    ThrowingMove(const ThrowingMove &other) = default;
+    ThrowingMove(ThrowingMove &&other) : value(other.value)
+    {
+        if (fail)
+        {
+            throw std::runtime_error("move failed");
+        }
+    }
+    ThrowingMove &operator=(ThrowingMove &&other) = default;
+};
+
+bool ThrowingMove::fail = false;
+
+TEST_CASE("ConcurrentDeque push that throws leaves the deque usable")
+{
+    ConcurrentDeque<ThrowingMove> deque;
+    ThrowingMove value(0);
+
+    // More failures than there are slots, so a slot stranded by each one would hang the next push
+    ThrowingMove::fail = true;
+    for (std::size_t i = 0; i < 2 * ConcurrentDeque<ThrowingMove>::kSlots; i++)
+    {
+        CHECK_THROWS_AS(deque.pushBack(value), std::runtime_error);
+        CHECK_THROWS_AS(deque.pushFront(value), std::runtime_error);
+    }
+    ThrowingMove::fail = false;
+    CHECK(deque.isEmpty());
+
+    deque.pushBack(ThrowingMove(1));
+    deque.pushFront(ThrowingMove(2));
+    REQUIRE(deque.popBack(value));
+    CHECK(value.value == 1);
+    REQUIRE(deque.popBack(value));
+    CHECK(value.value == 2);
+    CHECK_FALSE(deque.popFront(value));
+}
@@ -0,0 +1,144 @@
+#include "../external/doctest/doctest.h"
+#include "../src/IndexedList.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+TEST_CASE("IndexedList find, contains and remove")
+{
+    IndexedList<std::string> list;
+    CHECK(list.find("a").isPastEnd());
+    CHECK_FALSE(list.contains("a"));
+    list.remove("a");
+    CHECK(list.isEmpty());
+
+    list.insertAtTail("b");
+    list.insertAtTail("c");
+    list.insertAtFront("a");
+    list.insertAfter("x", list.find("b"));
+    list.insertBefore("y", list.find("c"));
+
+    std::ostringstream oss;
+    list.print(oss, true);
+    CHECK(oss.str() == "a b x y c \n");
+    CHECK(list.size() == 5);
+    CHECK(list.contains("x"));
+    CHECK(list.find("y").retrieve() == "y");
+
+    list.remove("x");
+    list.remove("not there");
+    CHECK_FALSE(list.contains("x"));
+    CHECK(list.size() == 4);
+
+    ListItr<std::string> next = list.erase(list.find("a"));
+    CHECK(next.retrieve() == "b");
+    CHECK(list.first().retrieve() == "b");
+    CHECK_FALSE(list.contains("a"));
+    CHECK(list.find("a").isPastEnd());
+}
+
+TEST_CASE("IndexedList duplicates")
+{
+    IndexedList<int> list;
+    list.insertAtTail(1);
+    list.insertAtTail(2);
+    list.insertAtTail(1);
+    list.insertAtTail(1);
+    CHECK(list.occurrences(1) == 3);
+
+    ListItr<int> oldest = list.find(1);
+    CHECK(oldest == list.first());
+
+    list.remove(1);
+    CHECK(list.occurrences(1) == 2);
+    CHECK(list.first().retrieve() == 2);
+
+    list.erase(list.last());
+    CHECK(list.occurrences(1) == 1);
+    list.remove(1);
+    CHECK_FALSE(list.contains(1));
+    CHECK(list.size() == 1);
+
+    list.makeEmpty();
+    CHECK_FALSE(list.contains(2));
+    CHECK(list.isEmpty());
+}
+
+TEST_CASE("IndexedList erases any duplicate by position")
+{
+    IndexedList<int> list;
+    std::vector<ListItr<int>> sevens;
+    for (int i = 0; i < 1000; i++)
+    {
+        list.insertAtTail(7);
+        sevens.push_back(list.last());
+        list.insertAtTail(1000 + i);
+    }
+    CHECK(list.occurrences(7) == 1000);
+
+    // Erase every other occurrence from the middle of the chain (the newest among them), then the oldest
+    // and the newest left
+    for (std::size_t i = 1; i < sevens.size(); i += 2)
+    {
+        list.erase(sevens[i]);
+    }
+    list.erase(sevens[0]);
+    list.erase(sevens[998]);
+    CHECK(list.occurrences(7) == 498);
+    CHECK(list.find(7) == sevens[2]);
+
+    // remove() keeps taking the oldest occurrence left
+    list.remove(7);
+    CHECK(list.find(7) == sevens[4]);
+    list.insertAtFront(7);
+    CHECK(list.find(7) == sevens[4]);
+    for (int i = 0; i < 497; i++)
+    {
+        list.remove(7);
+    }
+    CHECK(list.occurrences(7) == 1);
+    CHECK(list.find(7) == list.first());
+    list.remove(7);
+    CHECK(list.occurrences(7) == 0);
+    CHECK(list.size() == 1000);
+    CHECK(list.contains(1000));
+}
+
+TEST_CASE("IndexedList copies and moves keep the index in sync")
+{
+    ListNodePool<int> pool;
+    IndexedList<int> list(pool);
+    for (int i = 0; i < 100; i++)
+    {
+        list.insertAtTail(i);
+    }
+
+    IndexedList<int> copy(list);
+    copy.remove(50);
+    CHECK(list.contains(50));
+    CHECK_FALSE(copy.contains(50));
+    CHECK(copy.find(51).retrieve() == 51);
+
+    list.remove(10);
+    CHECK_FALSE(list.contains(10));
+    CHECK(copy.contains(10));
+
+    IndexedList<int> moved(std::move(copy));
+    CHECK(moved.size() == 99);
+    CHECK(copy.isEmpty());
+    CHECK_FALSE(copy.contains(1));
+    moved.remove(99);
+    CHECK(moved.last().retrieve() == 98);
+
+    list = moved;
+    CHECK(list.contains(10));
+    CHECK_FALSE(list.contains(50));
+    list.remove(10);
+    CHECK(moved.contains(10));
+
+    copy = std::move(list);
+    CHECK(copy.size() == 97);
+    CHECK(list.isEmpty());
+    CHECK(copy.find(0) == copy.first());
+}
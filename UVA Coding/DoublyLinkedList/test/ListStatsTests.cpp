@@ -0,0 +1,105 @@
+#include "../external/doctest/doctest.h"
+#include "../src/List.h"
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using CountedList = List<int, std::allocator<int>, CountingListStats>;
+
+// The members of List<int> without any statistics policy
+struct PlainListLayout
+{
+    std::allocator<ListNode<int>> allocator;
+    ListNode<int> *head;
+    ListNode<int> *tail;
+    int count;
+    ListNodePool<int> *pool;
+};
+
+TEST_CASE("The default statistics policy costs no space and reports zeros")
+{
+    CHECK(std::is_empty<NoListStats>::value);
+    CHECK(sizeof(List<int>) == sizeof(PlainListLayout));
+    CHECK(sizeof(CountedList) > sizeof(List<int>));
+
+    List<int> list{1, 2, 3};
+    list.find(3);
+    list.remove(9);
+    ListStatsSnapshot stats = list.statistics();
+    CHECK(stats.finds == 0);
+    CHECK(stats.removeMisses == 0);
+    CHECK(stats.bytesHeld == 0);
+}
+
+TEST_CASE("CountingListStats counts a workload")
+{
+    CountedList list;
+    for (int i = 0; i < 10; i++)
+    {
+        list.insertAtTail(i);
+    }
+    list.insertAtFront(-1);
+    list.emplaceFront(-2);
+    list.insertBefore(100, list.find(5));
+    list.insertAfter(200, list.find(5));
+    list.insertBefore(300, list.first());
+
+    ListStatsSnapshot stats = list.statistics();
+    CHECK(stats.insertsAtTail == 10);
+    CHECK(stats.insertsAtFront == 2);
+    CHECK(stats.insertsBefore == 2);
+    CHECK(stats.insertsAfter == 1);
+    CHECK(stats.allocations == 15);
+    CHECK(stats.finds == 2);
+    CHECK(stats.findHops == 8 + 9);
+    CHECK(stats.maxFindHops == 9);
+    CHECK(stats.averageFindHops() == doctest::Approx(8.5));
+    CHECK(stats.bytesHeld == (15 + 2) * sizeof(ListNode<int>));
+
+    list.remove(999);
+    list.remove(100);
+    CHECK(list.removeIf([](int x) { return x >= 200; }) == 2);
+    list.erase(list.first());
+    stats = list.statistics();
+    CHECK(stats.finds == 4);
+    CHECK(stats.maxFindHops == 15);
+    CHECK(stats.removeMisses == 1);
+    CHECK(stats.removes == 4);
+    CHECK(stats.frees == 4);
+    CHECK(stats.bytesHeld == (11 + 2) * sizeof(ListNode<int>));
+
+    CountedList copy(list);
+    CHECK(copy.statistics().copies == 1);
+    CHECK(copy.statistics().elementsCopied == 11);
+    CHECK(copy.statistics().rangeInserts == 11);
+    CHECK(copy.statistics().allocations == 11);
+    copy = list;
+    CHECK(copy.statistics().copies == 2);
+    CHECK(copy.statistics().frees == 11);
+    CHECK(list.statistics().copies == 0);
+
+    std::string json = list.statistics().toJson();
+    CHECK(json.front() == '{');
+    CHECK(json.back() == '}');
+    CHECK(json.find("\"removeMisses\":1,") != std::string::npos);
+    CHECK(json.find("\"maxFindHops\":15,") != std::string::npos);
+}
+
+TEST_CASE("CountingListStats counts pooled nodes and bulk frees")
+{
+    ListNodePool<int> pool;
+    List<int, std::allocator<int>, CountingListStats> list(pool);
+    std::vector<int> values{5, 5, 6, 6, 7};
+    list.assign(values.begin(), values.end());
+    CHECK(list.unique() == 2);
+    list.makeEmpty();
+
+    ListStatsSnapshot stats = list.statistics();
+    CHECK(stats.rangeInserts == 5);
+    CHECK(stats.allocations == 5);
+    CHECK(stats.removes == 2);
+    CHECK(stats.frees == 5);
+    CHECK(stats.bytesHeld == 2 * sizeof(ListNode<int>));
+}
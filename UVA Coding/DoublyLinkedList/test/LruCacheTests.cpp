@@ -0,0 +1,104 @@
+#include "../external/doctest/doctest.h"
+#include "../src/LruCache.h"
+
+#include <cstdint>
+#include <string>
+
+struct StringSizer
+{
+    std::size_t operator()(const int &, const std::string &value) const
+    {
+        return value.size();
+    }
+};
+
+TEST_CASE("LruCache evicts the least recently used entry")
+{
+    LruCache<int, std::string> cache(3);
+    CHECK(cache.get(1) == nullptr);
+
+    cache.put(1, "one");
+    cache.put(2, "two");
+    cache.put(3, "three");
+    CHECK(cache.size() == 3);
+
+    REQUIRE(cache.get(1) != nullptr);
+    CHECK(*cache.get(1) == "one");
+
+    cache.put(4, "four");
+    CHECK_FALSE(cache.contains(2));
+    CHECK(cache.contains(1));
+    CHECK(cache.contains(3));
+    CHECK(cache.contains(4));
+
+    cache.put(3, "THREE");
+    cache.put(5, "five");
+    CHECK_FALSE(cache.contains(1));
+    CHECK(*cache.get(3) == "THREE");
+
+    LruCacheStats stats = cache.stats();
+    CHECK(stats.hits == 3);
+    CHECK(stats.misses == 1);
+    CHECK(stats.evictions == 2);
+
+    CHECK(cache.erase(3));
+    CHECK_FALSE(cache.erase(3));
+    CHECK(cache.size() == 2);
+
+    cache.resetStats();
+    CHECK(cache.stats().hits == 0);
+    cache.clear();
+    CHECK(cache.size() == 0);
+    CHECK(cache.get(4) == nullptr);
+}
+
+TEST_CASE("LruCache capacity by bytes")
+{
+    LruCache<int, std::string, std::hash<int>, StringSizer> cache(100, 10);
+
+    CHECK(cache.put(1, "aaaa"));
+    CHECK(cache.put(2, "bbbb"));
+    CHECK(cache.bytes() == 8);
+
+    CHECK(cache.put(3, "cccc"));
+    CHECK(cache.bytes() == 8);
+    CHECK_FALSE(cache.contains(1));
+
+    cache.get(2);
+    CHECK(cache.put(4, "dddddddd"));
+    CHECK(cache.size() == 1);
+    CHECK(cache.contains(4));
+    CHECK(cache.stats().evictions == 3);
+
+    CHECK_FALSE(cache.put(5, "this is too large"));
+    CHECK_FALSE(cache.contains(5));
+
+    CHECK(cache.put(4, "dd"));
+    CHECK(cache.bytes() == 2);
+    CHECK_FALSE(cache.put(4, "this is too large"));
+    CHECK(cache.size() == 0);
+    CHECK(cache.bytes() == 0);
+}
+
+TEST_CASE("LruCache with zero capacity stores nothing")
+{
+    LruCache<int, int> cache(0);
+    CHECK_FALSE(cache.put(1, 1));
+    CHECK(cache.get(1) == nullptr);
+}
+
+TEST_CASE("LruCache limited by bytes only")
+{
+    // SIZE_MAX entries must not wrap to a negative count and evict everything on each put
+    LruCache<int, std::string, std::hash<int>, StringSizer> cache(SIZE_MAX, 12);
+    CHECK(cache.put(1, "aaaa"));
+    CHECK(cache.put(2, "bbbb"));
+    CHECK(cache.put(3, "cccc"));
+    CHECK(cache.size() == 3);
+    CHECK(cache.stats().evictions == 0);
+
+    CHECK(cache.put(4, "dddd"));
+    CHECK(cache.size() == 3);
+    CHECK_FALSE(cache.contains(1));
+    CHECK(cache.contains(2));
+}
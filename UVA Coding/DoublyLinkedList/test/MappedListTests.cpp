@@ -0,0 +1,159 @@
+#include "../external/doctest/doctest.h"
+#include "../src/MappedList.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+static std::string mappedListPath(const char *name)
+{
+    return "/tmp/" + std::string(name) + "." + std::to_string(::getpid()) + ".dll";
+}
+
+TEST_CASE("MappedList basic operations")
+{
+    const std::string path = mappedListPath("mapped_basic");
+    std::remove(path.c_str());
+    {
+        MappedList<int> list(path);
+        CHECK(list.isEmpty());
+        CHECK(list.first().isPastEnd());
+        CHECK(list.last().isPastBeginning());
+
+        list.insertAtTail(20);
+        list.insertAtTail(40);
+        list.insertAtFront(10);
+        list.insertBefore(30, list.find(40));
+        list.insertAfter(50, list.last());
+        CHECK(list.size() == 5);
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{10, 20, 30, 40, 50});
+        CHECK(std::vector<int>(list.rbegin(), list.rend()) == std::vector<int>{50, 40, 30, 20, 10});
+
+        std::ostringstream forward;
+        list.print(forward, true);
+        CHECK(forward.str() == "10 20 30 40 50 \n");
+
+        list.remove(30);
+        list.remove(99);
+        CHECK(list.size() == 4);
+        CHECK(list.find(30).isPastEnd());
+
+        MappedListItr<int> itr = list.erase(list.find(20));
+        CHECK(itr.retrieve() == 40);
+        CHECK_THROWS_AS(list.erase(list.end()), std::invalid_argument);
+        CHECK_THROWS_AS(list.insertAfter(1, list.end()), std::invalid_argument);
+        itr = list.first();
+        itr.moveBackward();
+        CHECK(itr.isPastBeginning());
+        CHECK_THROWS_AS(itr.retrieve(), std::runtime_error);
+        CHECK_THROWS_AS(list.insertBefore(1, itr), std::invalid_argument);
+
+        list.makeEmpty();
+        CHECK(list.isEmpty());
+        list.insertAtTail(7);
+        CHECK(list.first().retrieve() == 7);
+    }
+    std::remove(path.c_str());
+}
+
+struct MappedRecord
+{
+    long long id;
+    double score;
+    char tag[12];
+
+    bool operator!=(const MappedRecord &other) const
+    {
+        return id != other.id;
+    }
+};
+
+TEST_CASE("MappedList survives reopening and grows the file")
+{
+    const std::string path = mappedListPath("mapped_reopen");
+    std::remove(path.c_str());
+    std::size_t initialBytes;
+    {
+        MappedList<MappedRecord> list(path);
+        initialBytes = list.fileBytes();
+        MappedListItr<MappedRecord> middle;
+        for (long long i = 0; i < 50000; i++)
+        {
+            list.insertAtTail(MappedRecord{i, i * 0.5, "rec"});
+            if (i == 100)
+            {
+                middle = list.last();
+            }
+        }
+        CHECK(list.fileBytes() > initialBytes);
+        CHECK(middle.retrieve().id == 100);
+
+        for (long long i = 0; i <= 200; i += 2)
+        {
+            list.remove(MappedRecord{i, 0, ""});
+        }
+        CHECK(list.size() == 50000 - 101);
+        list.sync();
+    }
+    {
+        MappedList<MappedRecord> list(path);
+        std::vector<long long> ids;
+        for (const MappedRecord &record : list)
+        {
+            ids.push_back(record.id);
+        }
+        CHECK(ids.size() == list.size());
+        CHECK(ids.size() == 50000 - 101);
+        CHECK(ids.front() == 1);
+        CHECK(ids[100] == 201);
+        CHECK(ids.back() == 49999);
+        std::size_t bytes = list.fileBytes();
+        list.insertAtFront(MappedRecord{-1, 0, ""});
+        CHECK(list.fileBytes() == bytes);
+        CHECK(list.first().retrieve().id == -1);
+    }
+    std::remove(path.c_str());
+}
+
+TEST_CASE("MappedList copies values out of the mapping before growing it")
+{
+    const std::string path = mappedListPath("mapped_grow");
+    std::remove(path.c_str());
+    {
+        MappedList<long long> list(path);
+        list.insertAtTail(42);
+        std::size_t bytes = list.fileBytes();
+        while (list.fileBytes() == bytes)
+        {
+            list.insertAtTail(list.first().retrieve());
+        }
+        CHECK(list.last().retrieve() == 42);
+
+        MappedListItr<long long> itr = list.first();
+        list.reserve(100000);
+        CHECK(list.fileBytes() >= 100000 * 3 * sizeof(long long));
+        CHECK(itr.retrieve() == 42);
+    }
+    std::remove(path.c_str());
+}
+
+TEST_CASE("MappedList rejects files of another type")
+{
+    const std::string path = mappedListPath("mapped_type");
+    std::remove(path.c_str());
+    {
+        MappedList<int> list(path);
+        list.insertAtTail(1);
+    }
+    CHECK_THROWS_AS(MappedList<double>{path}, std::runtime_error);
+    {
+        std::ofstream garbage(path, std::ios::binary | std::ios::trunc);
+        garbage << std::string(8192, 'x');
+    }
+    CHECK_THROWS_AS(MappedList<int>{path}, std::runtime_error);
+    CHECK_THROWS_AS(MappedList<int>("/nonexistent/dir/list.dll"), std::system_error);
+    std::remove(path.c_str());
+}
@@ -0,0 +1,198 @@
+#include "../external/doctest/doctest.h"
+#include "../src/PersistentList.h"
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+template <typename T>
+static std::vector<T> contents(const PersistentList<T> &list)
+{
+    return std::vector<T>(list.begin(), list.end());
+}
+
+TEST_CASE("PersistentList basic operations")
+{
+    PersistentList<int> empty;
+    CHECK(empty.isEmpty());
+    CHECK(empty.first().isPastEnd());
+    CHECK(empty.last().isPastEnd());
+    CHECK_THROWS_AS(empty.removeFirst(), std::runtime_error);
+
+    PersistentList<int> list = empty.insertAtTail(20).insertAtTail(30).insertAtFront(10);
+    CHECK(empty.isEmpty());
+    CHECK(list.size() == 3);
+    CHECK(contents(list) == std::vector<int>{10, 20, 30});
+    CHECK(list.first().retrieve() == 10);
+    CHECK(list.last().retrieve() == 30);
+    CHECK(*list.find(20) == 20);
+    CHECK(list.find(99).isPastEnd());
+    CHECK_THROWS_AS(list.find(99).retrieve(), std::runtime_error);
+
+    std::ostringstream oss;
+    list.print(oss);
+    CHECK(oss.str() == "10 20 30 \n");
+
+    PersistentList<int> withoutMiddle = list.remove(20);
+    CHECK(contents(withoutMiddle) == std::vector<int>{10, 30});
+    CHECK(withoutMiddle.last().retrieve() == 30);
+    CHECK(list.remove(99).sharesNodesWith(list));
+
+    PersistentList<int> withoutLast = list.erase(list.last());
+    CHECK(contents(withoutLast) == std::vector<int>{10, 20});
+    CHECK(withoutLast.last().retrieve() == 20);
+
+    PersistentList<int> single = PersistentList<int>{7};
+    CHECK(single.removeFirst().isEmpty());
+    CHECK(single.removeFirst().last().isPastEnd());
+    CHECK(contents(list.removeFirst()) == std::vector<int>{20, 30});
+    CHECK(list.removeFirst().last() == list.last());
+}
+
+TEST_CASE("PersistentList versions share their unchanged nodes")
+{
+    PersistentList<std::string> base{"a", "b", "c", "d"};
+
+    PersistentList<std::string> edited = base.insertBefore("x", base.find("c"));
+    CHECK(contents(edited) == std::vector<std::string>{"a", "b", "x", "c", "d"});
+    CHECK(contents(base) == std::vector<std::string>{"a", "b", "c", "d"});
+    // The nodes from "c" on are shared, the ones in front of the change are copies
+    CHECK(edited.find("c") == base.find("c"));
+    CHECK(edited.find("d") == base.find("d"));
+    CHECK(edited.find("a") != base.find("a"));
+    CHECK(edited.last() == base.last());
+
+    PersistentList<std::string> pushed = base.insertAtFront("z");
+    CHECK(pushed.find("a") == base.find("a"));
+    CHECK(pushed.removeFirst().sharesNodesWith(base));
+
+    PersistentList<std::string> after = base.insertAfter("e", base.last());
+    CHECK(contents(after) == std::vector<std::string>{"a", "b", "c", "d", "e"});
+    CHECK(after.last().retrieve() == "e");
+    CHECK(base.last().retrieve() == "d");
+    CHECK(contents(base.insertBefore("end", base.end())).back() == "end");
+
+    // A position only belongs to the versions that share its node
+    CHECK_THROWS_AS(base.erase(edited.find("a")), std::invalid_argument);
+    CHECK_THROWS_AS(base.insertBefore("y", edited.find("x")), std::invalid_argument);
+    CHECK_THROWS_AS(base.insertAfter("y", base.end()), std::invalid_argument);
+    CHECK_THROWS_AS(base.erase(base.end()), std::invalid_argument);
+    CHECK(contents(edited.erase(base.find("d"))) == std::vector<std::string>{"a", "b", "x", "c"});
+
+    // Versions outlive the ones they were derived from
+    PersistentList<std::string> survivor;
+    {
+        PersistentList<std::string> temporary = base.insertAtTail("t");
+        survivor = temporary.remove("a");
+    }
+    CHECK(contents(survivor) == std::vector<std::string>{"b", "c", "d", "t"});
+
+    PersistentList<std::string> moved = std::move(survivor);
+    CHECK(survivor.isEmpty());
+    CHECK(moved.size() == 4);
+    moved = moved;
+    CHECK(moved.size() == 4);
+}
+
+struct ThrowingCopy
+{
+    static int copiesLeft;
+    int value;
+
+    ThrowingCopy(int v) : value(v) {}
+    ThrowingCopy(const ThrowingCopy &other) : value(other.value)
+    {
+        if (copiesLeft-- == 0)
+        {
+            throw std::runtime_error("copy failed");
+        }
+    }
+    bool operator!=(const ThrowingCopy &other) const
+    {
+        return value != other.value;
+    }
+};
+
+int ThrowingCopy::copiesLeft = 1000;
+
+TEST_CASE("PersistentList edits leave the old version intact when a copy throws")
+{
+    std::vector<ThrowingCopy> values{1, 2, 3, 4, 5};
+    PersistentList<ThrowingCopy> list(values.begin(), values.end());
+
+    ThrowingCopy::copiesLeft = 2;
+    CHECK_THROWS_AS(list.insertAtTail(ThrowingCopy(6)), std::runtime_error);
+    ThrowingCopy::copiesLeft = 2;
+    CHECK_THROWS_AS(list.erase(list.last()), std::runtime_error);
+    ThrowingCopy::copiesLeft = 2;
+    CHECK_THROWS_AS(PersistentList<ThrowingCopy>(values.begin(), values.end()), std::runtime_error);
+    ThrowingCopy::copiesLeft = 1000;
+
+    CHECK(list.size() == 5);
+    int sum = 0;
+    for (const ThrowingCopy &value : list)
+    {
+        sum += value.value;
+    }
+    CHECK(sum == 15);
+}
+
+TEST_CASE("PersistentList releases long histories without recursion")
+{
+    PersistentList<int> list;
+    std::vector<PersistentList<int>> history;
+    for (int i = 0; i < 200000; i++)
+    {
+        list = list.insertAtFront(i);
+        if (i % 50000 == 0)
+        {
+            history.push_back(list);
+        }
+    }
+    CHECK(list.size() == 200000);
+    CHECK(history.back().size() == 150001);
+    list = PersistentList<int>();
+    CHECK(history.front().first().retrieve() == 0);
+    history.clear();
+}
+
+TEST_CASE("PersistentList versions are shared across threads without locks")
+{
+    PersistentList<int> base;
+    for (int i = 0; i < 1000; i++)
+    {
+        base = base.insertAtFront(i);
+    }
+
+    std::vector<std::thread> threads;
+    std::vector<long long> sums(4, 0);
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&base, &sums, t]() {
+            PersistentList<int> mine = base;
+            for (int round = 0; round < 200; round++)
+            {
+                PersistentList<int> next = mine.insertAtFront(t).remove(round);
+                long long sum = 0;
+                for (int value : base)
+                {
+                    sum += value;
+                }
+                sums[t] = sum;
+                mine = next.removeFirst();
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (long long sum : sums)
+    {
+        CHECK(sum == 499500);
+    }
+    CHECK(base.size() == 1000);
+}
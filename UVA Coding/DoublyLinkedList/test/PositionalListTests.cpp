@@ -0,0 +1,157 @@
+#include "../external/doctest/doctest.h"
+#include "../src/PositionalList.h"
+
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+TEST_CASE("PositionalList keeps the List API")
+{
+    PositionalList<int> list;
+    CHECK(list.isEmpty());
+    CHECK(list.first().isPastEnd());
+    CHECK(list.last().isPastBeginning());
+
+    list.insertAtTail(20);
+    list.insertAtFront(10);
+    list.insertAtTail(40);
+    list.insertBefore(30, list.find(40));
+    list.insertAfter(50, list.last());
+    CHECK(list.size() == 5);
+    CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{10, 20, 30, 40, 50});
+    CHECK(std::vector<int>(list.rbegin(), list.rend()) == std::vector<int>{50, 40, 30, 20, 10});
+
+    std::ostringstream backward;
+    list.print(backward, false);
+    CHECK(backward.str() == "50 40 30 20 10 \n");
+
+    list.remove(30);
+    PositionalListItr<int> itr = list.erase(list.find(20));
+    CHECK(itr.retrieve() == 40);
+    CHECK(list.size() == 3);
+    CHECK_THROWS_AS(list.erase(list.end()), std::invalid_argument);
+    CHECK_THROWS_AS(list.insertAfter(1, list.end()), std::invalid_argument);
+
+    PositionalList<int> copy(list);
+    PositionalList<int> moved(std::move(list));
+    CHECK(list.isEmpty());
+    list.insertAtTail(1);
+    CHECK(list.at(0) == 1);
+    copy.insertAtFront(0);
+    CHECK(std::vector<int>(copy.begin(), copy.end()) == std::vector<int>{0, 10, 40, 50});
+    CHECK(std::vector<int>(moved.begin(), moved.end()) == std::vector<int>{10, 40, 50});
+    moved = copy;
+    CHECK(moved.at(3) == 50);
+    moved = std::move(list);
+    CHECK(moved.size() == 1);
+}
+
+TEST_CASE("PositionalList positional operations")
+{
+    PositionalList<int> list;
+    for (int i = 0; i < 10; i++)
+    {
+        list.insertAtTail(i);
+    }
+
+    CHECK(list.at(0) == 0);
+    CHECK(list.at(9) == 9);
+    CHECK_THROWS_AS(list.at(10), std::out_of_range);
+    CHECK_THROWS_AS(list.at(-1), std::out_of_range);
+    CHECK(list.itrAt(10).isPastEnd());
+
+    list.insertAt(0, 100);
+    list.insertAt(11, 200);
+    list.insertAt(5, 300);
+    CHECK(list.at(0) == 100);
+    CHECK(list.at(5) == 300);
+    CHECK(list.at(12) == 200);
+    CHECK(list.indexOf(list.find(300)) == 5);
+    CHECK(list.indexOf(list.end()) == 13);
+    CHECK(list.indexOf(list.first()) == 0);
+
+    list.eraseAt(5);
+    list.eraseAt(0);
+    list.eraseAt(10);
+    CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    CHECK_THROWS_AS(list.eraseAt(10), std::out_of_range);
+    CHECK_THROWS_AS(list.insertAt(11, 0), std::out_of_range);
+}
+
+TEST_CASE("PositionalList matches a vector under random edits")
+{
+    PositionalList<int> list;
+    std::vector<int> expected;
+    std::mt19937 rng(42);
+    for (int step = 0; step < 20000; step++)
+    {
+        int size = static_cast<int>(expected.size());
+        unsigned action = rng() % 8;
+        if (size == 0 || action < 3)
+        {
+            int index = static_cast<int>(rng() % static_cast<unsigned>(size + 1));
+            list.insertAt(index, step);
+            expected.insert(expected.begin() + index, step);
+        }
+        else if (action < 5)
+        {
+            int index = static_cast<int>(rng() % static_cast<unsigned>(size));
+            list.eraseAt(index);
+            expected.erase(expected.begin() + index);
+        }
+        else if (action < 6)
+        {
+            // Iterator-based edits must keep the widths right too
+            int index = static_cast<int>(rng() % static_cast<unsigned>(size));
+            PositionalListItr<int> itr = list.itrAt(index);
+            list.insertBefore(-step, itr);
+            expected.insert(expected.begin() + index, -step);
+            list.erase(itr);
+            expected.erase(expected.begin() + index + 1);
+        }
+        else
+        {
+            int index = static_cast<int>(rng() % static_cast<unsigned>(size));
+            REQUIRE(list.at(index) == expected[index]);
+            REQUIRE(list.indexOf(list.itrAt(index)) == index);
+        }
+        REQUIRE(list.size() == static_cast<int>(expected.size()));
+    }
+    CHECK(std::vector<int>(list.begin(), list.end()) == expected);
+}
+
+struct PositionalThrowingCopy
+{
+    static int copiesLeft;
+    int value;
+
+    PositionalThrowingCopy(int v) : value(v) {}
+    PositionalThrowingCopy(const PositionalThrowingCopy &other) : value(other.value)
+    {
+        if (copiesLeft-- == 0)
+        {
+            throw std::runtime_error("copy failed");
+        }
+    }
+};
+
+int PositionalThrowingCopy::copiesLeft = 1000;
+
+TEST_CASE("PositionalList copy constructor cleans up when a copy throws")
+{
+    PositionalList<PositionalThrowingCopy> list;
+    for (int i = 0; i < 5; i++)
+    {
+        list.insertAtTail(PositionalThrowingCopy(i));
+    }
+
+    // The nodes copied before the failure are released once, by the destructor
+    PositionalThrowingCopy::copiesLeft = 2;
+    CHECK_THROWS_AS(PositionalList<PositionalThrowingCopy>{list}, std::runtime_error);
+    PositionalThrowingCopy::copiesLeft = 1000;
+
+    PositionalList<PositionalThrowingCopy> copy(list);
+    CHECK(copy.size() == 5);
+    CHECK(copy.at(4).value == 4);
+}
@@ -0,0 +1,111 @@
+#include "../external/doctest/doctest.h"
+#include "../src/SelfOrganizingList.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+template <typename ListType>
+static std::vector<int> contents(const ListType &list)
+{
+    std::vector<int> values;
+    list.forEach([&values](int value) { values.push_back(value); });
+    return values;
+}
+
+template <typename ListType>
+static void fill(ListType &list)
+{
+    for (int i = 1; i <= 5; i++)
+    {
+        list.insertAtTail(i);
+    }
+}
+
+TEST_CASE("SelfOrganizingList with move-to-front")
+{
+    SelfOrganizingList<int, MoveToFrontPolicy> list;
+    CHECK(list.isEmpty());
+    CHECK(list.find(1) == nullptr);
+    fill(list);
+    CHECK(list.size() == 5);
+
+    int *found = list.find(4);
+    REQUIRE(found != nullptr);
+    CHECK(*found == 4);
+    CHECK(contents(list) == std::vector<int>{4, 1, 2, 3, 5});
+    list.find(5);
+    list.find(5);
+    CHECK(contents(list) == std::vector<int>{5, 4, 1, 2, 3});
+
+    // The pointer stays valid: the node was relinked, not reallocated
+    CHECK(*found == 4);
+    CHECK(list.find(9) == nullptr);
+    CHECK(list.contains(2));
+    CHECK_FALSE(list.contains(9));
+    CHECK(contents(list) == std::vector<int>{5, 4, 1, 2, 3});
+
+    std::ostringstream oss;
+    list.print(oss);
+    CHECK(oss.str() == "5 4 1 2 3 \n");
+
+    CHECK(list.remove(4));
+    CHECK_FALSE(list.remove(4));
+    CHECK(contents(list) == std::vector<int>{5, 1, 2, 3});
+    list.makeEmpty();
+    CHECK(list.isEmpty());
+}
+
+TEST_CASE("SelfOrganizingList with transpose")
+{
+    SelfOrganizingList<int, TransposePolicy> list;
+    fill(list);
+    list.find(4);
+    CHECK(contents(list) == std::vector<int>{1, 2, 4, 3, 5});
+    list.find(4);
+    list.find(4);
+    CHECK(contents(list) == std::vector<int>{4, 1, 2, 3, 5});
+    list.find(4);
+    CHECK(contents(list) == std::vector<int>{4, 1, 2, 3, 5});
+    list.insertAtFront(0);
+    list.find(4);
+    CHECK(contents(list) == std::vector<int>{4, 0, 1, 2, 3, 5});
+}
+
+TEST_CASE("SelfOrganizingList with counts")
+{
+    SelfOrganizingList<int, CountPolicy> list;
+    fill(list);
+    list.find(3);
+    CHECK(contents(list) == std::vector<int>{3, 1, 2, 4, 5});
+    list.find(5);
+    // 5 has as many hits as 3, so it stays behind it
+    CHECK(contents(list) == std::vector<int>{3, 5, 1, 2, 4});
+    list.find(5);
+    CHECK(contents(list) == std::vector<int>{5, 3, 1, 2, 4});
+    list.find(2);
+    list.find(2);
+    CHECK(contents(list) == std::vector<int>{5, 2, 3, 1, 4});
+    list.find(2);
+    CHECK(contents(list) == std::vector<int>{2, 5, 3, 1, 4});
+}
+
+TEST_CASE("SelfOrganizingList shortens find walks under a skewed stream")
+{
+    SelfOrganizingList<std::string, MoveToFrontPolicy, CountingListStats> list;
+    for (int i = 0; i < 100; i++)
+    {
+        list.insertAtTail("key" + std::to_string(i));
+    }
+    for (int round = 0; round < 50; round++)
+    {
+        list.find("key99");
+        list.find("key98");
+    }
+    ListStatsSnapshot stats = list.statistics();
+    CHECK(stats.finds == 100);
+    CHECK(stats.maxFindHops == 100);
+    // After the first two walks both keys stay within the first two nodes
+    CHECK(stats.findHops == 100 + 100 + 98 * 2);
+    CHECK(stats.allocations == 100);
+}
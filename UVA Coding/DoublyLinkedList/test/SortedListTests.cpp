@@ -0,0 +1,247 @@
+#include "../external/doctest/doctest.h"
+#include "../src/SortedList.h"
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST_CASE("SortedList keeps its elements in order")
+{
+    SortedList<int> list;
+    CHECK(list.isEmpty());
+    CHECK(list.first().isPastEnd());
+    CHECK(list.last().isPastBeginning());
+    CHECK_FALSE(list.contains(1));
+    CHECK(list.lowerBound(1).isPastEnd());
+
+    for (int x : {50, 10, 40, 20, 30})
+    {
+        CHECK(list.insert(x).retrieve() == x);
+    }
+    CHECK(list.size() == 5);
+    CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{10, 20, 30, 40, 50});
+    CHECK(std::vector<int>(list.rbegin(), list.rend()) == std::vector<int>{50, 40, 30, 20, 10});
+
+    std::ostringstream backward;
+    list.print(backward, false);
+    CHECK(backward.str() == "50 40 30 20 10 \n");
+
+    CHECK(list.contains(30));
+    CHECK_FALSE(list.contains(35));
+    CHECK(*list.lowerBound(30) == 30);
+    CHECK(*list.lowerBound(35) == 40);
+    CHECK(*list.upperBound(30) == 40);
+    CHECK(list.lowerBound(60) == list.end());
+    CHECK(list.upperBound(5) == list.first());
+
+    SortedListItr<int> itr = list.lowerBound(20);
+    itr.moveBackward();
+    CHECK(itr.retrieve() == 10);
+    itr.moveBackward();
+    CHECK(itr.isPastBeginning());
+    CHECK_THROWS_AS(itr.retrieve(), std::runtime_error);
+
+    CHECK(list.erase(30));
+    CHECK_FALSE(list.erase(30));
+    CHECK(list.erase(list.first()).retrieve() == 20);
+    CHECK_THROWS_AS(list.erase(list.end()), std::invalid_argument);
+    CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{20, 40, 50});
+
+    SortedList<int> copy(list);
+    SortedList<int> moved(std::move(list));
+    CHECK(list.isEmpty());
+    list.insert(1);
+    CHECK(list.contains(1));
+    copy.insert(45);
+    CHECK(std::vector<int>(copy.begin(), copy.end()) == std::vector<int>{20, 40, 45, 50});
+    CHECK(std::vector<int>(moved.begin(), moved.end()) == std::vector<int>{20, 40, 50});
+    moved = copy;
+    CHECK(moved.contains(45));
+    moved = std::move(list);
+    CHECK(moved.size() == 1);
+    moved.makeEmpty();
+    CHECK(moved.isEmpty());
+    moved.insert(7);
+    CHECK(*moved.first() == 7);
+}
+
+TEST_CASE("SortedList equal elements and comparators")
+{
+    using Entry = std::pair<int, std::string>;
+    auto byKey = [](const Entry &a, const Entry &b) { return a.first < b.first; };
+    SortedList<Entry, decltype(byKey)> list(byKey);
+
+    list.insert({2, "a"});
+    list.insert({1, "b"});
+    list.insert({2, "c"});
+    list.insert({3, "d"});
+    list.insert({2, "e"});
+
+    // Equal keys stay in insertion order
+    std::string order;
+    for (const Entry &entry : list)
+    {
+        order += entry.second;
+    }
+    CHECK(order == "baced");
+
+    CHECK(list.lowerBound({2, ""})->second == "a");
+    CHECK(list.upperBound({2, ""})->second == "d");
+
+    // Erasing a value removes the first of the equal ones; erasing a position removes exactly that one
+    CHECK(list.erase({2, ""}));
+    SortedListItr<Entry> e = list.lowerBound({2, ""});
+    e.moveForward();
+    CHECK(e->second == "e");
+    CHECK(list.erase(e)->second == "d");
+    CHECK(list.lowerBound({2, ""})->second == "c");
+    CHECK(list.size() == 3);
+
+    SortedList<int, std::greater<int>> descending;
+    for (int x : {3, 1, 4, 1, 5, 9, 2, 6})
+    {
+        descending.insert(x);
+    }
+    CHECK(std::vector<int>(descending.begin(), descending.end()) == std::vector<int>{9, 6, 5, 4, 3, 2, 1, 1});
+    CHECK(*descending.lowerBound(7) == 6);
+}
+
+TEST_CASE("SortedList ranges")
+{
+    SortedList<int> list;
+    for (int i = 0; i < 200; i++)
+    {
+        list.insert(i * 2);
+    }
+
+    auto values = [](const SortedListRange<int> &range) { return std::vector<int>(range.begin(), range.end()); };
+    CHECK(values(list.range(10, 17)) == std::vector<int>{10, 12, 14, 16});
+    CHECK(values(list.range(11, 18)) == std::vector<int>{12, 14, 16});
+    CHECK(list.range(11, 12).isEmpty());
+    CHECK(list.range(20, 20).isEmpty());
+    CHECK(list.range(30, 10).isEmpty());
+    CHECK(values(list.range(-5, 3)) == std::vector<int>{0, 2});
+    CHECK(values(list.range(394, 1000)) == std::vector<int>{394, 396, 398});
+
+    // Long enough that the end is found by a second descent instead of the walk
+    std::vector<int> wide = values(list.range(1, 301));
+    CHECK(wide.size() == 150);
+    CHECK(wide.front() == 2);
+    CHECK(wide.back() == 300);
+    CHECK(list.range(0, 1000).end() == list.end());
+}
+
+TEST_CASE("SortedList matches std::multiset under random operations")
+{
+    std::mt19937 rng(7);
+    SortedList<int> list;
+    std::multiset<int> reference;
+
+    for (int i = 0; i < 20000; i++)
+    {
+        int x = static_cast<int>(rng() % 2000);
+        switch (rng() % 5)
+        {
+        case 0:
+        case 1:
+            list.insert(x);
+            reference.insert(x);
+            break;
+        case 2:
+        {
+            auto found = reference.find(x);
+            CHECK(list.erase(x) == (found != reference.end()));
+            if (found != reference.end())
+            {
+                reference.erase(found);
+            }
+            break;
+        }
+        case 3:
+        {
+            SortedListItr<int> itr = list.upperBound(x);
+            if (!itr.isPastEnd())
+            {
+                CHECK(*itr == *reference.upper_bound(x));
+                list.erase(itr);
+                reference.erase(reference.upper_bound(x));
+            }
+            break;
+        }
+        default:
+        {
+            CHECK(list.contains(x) == (reference.count(x) > 0));
+            SortedListItr<int> itr = list.lowerBound(x);
+            auto expected = reference.lower_bound(x);
+            CHECK(itr.isPastEnd() == (expected == reference.end()));
+            if (!itr.isPastEnd())
+            {
+                CHECK(*itr == *expected);
+            }
+            int hi = x + static_cast<int>(rng() % 100);
+            SortedListRange<int> range = list.range(x, hi);
+            CHECK(std::distance(range.begin(), range.end()) ==
+                  std::distance(reference.lower_bound(x), reference.lower_bound(hi)));
+            break;
+        }
+        }
+    }
+
+    CHECK(list.size() == static_cast<int>(reference.size()));
+    CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>(reference.begin(), reference.end()));
+    CHECK(std::vector<int>(list.rbegin(), list.rend()) == std::vector<int>(reference.rbegin(), reference.rend()));
+
+    SortedList<int> copy = list;
+    CHECK(std::vector<int>(copy.begin(), copy.end()) == std::vector<int>(reference.begin(), reference.end()));
+    for (int x : reference)
+    {
+        CHECK(copy.erase(x));
+    }
+    CHECK(copy.isEmpty());
+    CHECK(copy.first() == copy.end());
+}
+
+struct SortedThrowingCopy
+{
+    static int copiesLeft;
+    int value;
+
+    SortedThrowingCopy(int v) : value(v) {}
+    SortedThrowingCopy(const SortedThrowingCopy &other) : value(other.value)
+    {
+        if (copiesLeft-- == 0)
+        {
+            throw std::runtime_error("copy failed");
+        }
+    }
+    bool operator<(const SortedThrowingCopy &other) const
+    {
+        return value < other.value;
+    }
+};
+
+int SortedThrowingCopy::copiesLeft = 1000;
+
+TEST_CASE("SortedList copy constructor cleans up when a copy throws")
+{
+    SortedList<SortedThrowingCopy> list;
+    for (int i = 0; i < 50; i++)
+    {
+        list.insert(SortedThrowingCopy(i));
+    }
+
+    // The nodes copied before the failure are released once, by the destructor
+    SortedThrowingCopy::copiesLeft = 20;
+    CHECK_THROWS_AS(SortedList<SortedThrowingCopy>{list}, std::runtime_error);
+    SortedThrowingCopy::copiesLeft = 1000;
+
+    SortedList<SortedThrowingCopy> copy(list);
+    CHECK(copy.size() == 50);
+    CHECK(copy.contains(SortedThrowingCopy(49)));
+    CHECK(copy.last()->value == 49);
+}
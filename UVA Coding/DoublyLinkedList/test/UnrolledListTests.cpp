@@ -0,0 +1,176 @@
+#include "../external/doctest/doctest.h"
+#include "../src/UnrolledList.h"
+
+#include <algorithm>
+#include <list>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+template <typename T, std::size_t N>
+static std::vector<T> contents(const UnrolledList<T, N> &list)
+{
+    return std::vector<T>(list.begin(), list.end());
+}
+
+TEST_CASE("UnrolledList basic operations")
+{
+    UnrolledList<int, 4> list;
+    CHECK(list.isEmpty());
+    CHECK(list.first().isPastEnd());
+    CHECK(list.last().isPastBeginning());
+
+    for (int i = 1; i <= 10; i++)
+    {
+        list.insertAtTail(i * 10);
+    }
+    CHECK(list.size() == 10);
+    CHECK(list.chunkCount() == 3);
+    CHECK(alignof(UnrolledListNode<int, 4>) == 64);
+
+    SUBCASE("Printing")
+    {
+        std::ostringstream oss;
+        list.print(oss, true);
+        CHECK(oss.str() == "10 20 30 40 50 60 70 80 90 100 \n");
+
+        std::ostringstream backward;
+        list.print(backward, false);
+        CHECK(backward.str() == "100 90 80 70 60 50 40 30 20 10 \n");
+    }
+
+    SUBCASE("Find and insert around a position")
+    {
+        UnrolledListItr<int, 4> itr = list.find(30);
+        CHECK(itr.retrieve() == 30);
+        list.insertAfter(35, itr);
+        itr = list.find(30);
+        list.insertBefore(25, itr);
+        CHECK(contents(list) == std::vector<int>{10, 20, 25, 30, 35, 40, 50, 60, 70, 80, 90, 100});
+        CHECK(list.find(999).isPastEnd());
+    }
+
+    SUBCASE("Remove merges underfull chunks")
+    {
+        for (int i = 1; i <= 8; i++)
+        {
+            list.remove(i * 10);
+        }
+        list.remove(12345);
+        CHECK(contents(list) == std::vector<int>{90, 100});
+        CHECK(list.chunkCount() == 1);
+        list.remove(90);
+        list.remove(100);
+        CHECK(list.isEmpty());
+        CHECK(list.chunkCount() == 0);
+    }
+
+    SUBCASE("Copy and move")
+    {
+        UnrolledList<int, 4> copy(list);
+        UnrolledList<int, 4> moved(std::move(list));
+        CHECK(list.isEmpty());
+        CHECK(contents(copy) == contents(moved));
+        list = copy;
+        CHECK(list.size() == 10);
+        copy.makeEmpty();
+        CHECK(copy.isEmpty());
+        CHECK(list.size() == 10);
+    }
+
+    SUBCASE("Cursor moves both ways")
+    {
+        UnrolledListItr<int, 4> itr = list.last();
+        CHECK(itr.retrieve() == 100);
+        for (int i = 0; i < 9; i++)
+        {
+            itr.moveBackward();
+        }
+        CHECK(itr.retrieve() == 10);
+        itr.moveBackward();
+        CHECK(itr.isPastBeginning());
+        list.insertAfter(5, itr);
+        CHECK(list.first().retrieve() == 5);
+        CHECK(std::vector<int>(list.rbegin(), list.rend()).front() == 100);
+    }
+
+    CHECK_THROWS_AS(list.insertAfter(1, list.end()), std::invalid_argument);
+}
+
+TEST_CASE("UnrolledList matches std::list under random operations")
+{
+    UnrolledList<std::string, 3> list;
+    std::list<std::string> reference;
+    std::mt19937 rng(7);
+
+    for (int step = 0; step < 3000; step++)
+    {
+        std::string value = std::to_string(rng() % 200);
+        switch (rng() % 5)
+        {
+        case 0:
+            list.insertAtTail(value);
+            reference.push_back(value);
+            break;
+        case 1:
+            list.insertAtFront(value);
+            reference.push_front(value);
+            break;
+        case 2:
+        {
+            UnrolledListItr<std::string, 3> itr = list.find(value);
+            std::list<std::string>::iterator ref = std::find(reference.begin(), reference.end(), value);
+            if (!itr.isPastEnd())
+            {
+                list.insertAfter(value + "a", itr);
+                reference.insert(std::next(ref), value + "a");
+            }
+            break;
+        }
+        default:
+        {
+            list.remove(value);
+            std::list<std::string>::iterator ref = std::find(reference.begin(), reference.end(), value);
+            if (ref != reference.end())
+            {
+                reference.erase(ref);
+            }
+            break;
+        }
+        }
+        REQUIRE(list.size() == static_cast<int>(reference.size()));
+    }
+    CHECK(contents(list) == std::vector<std::string>(reference.begin(), reference.end()));
+    CHECK(std::vector<std::string>(list.rbegin(), list.rend()) == std::vector<std::string>(reference.rbegin(), reference.rend()));
+}
+
+TEST_CASE("UnrolledList traversal kernels")
+{
+    UnrolledList<int, 4> list;
+    for (int i = 0; i < 50; i++)
+    {
+        list.insertAtTail(i % 7);
+    }
+
+    CHECK(list.occurrences(3) == 7);
+    CHECK(list.occurrences(9) == 0);
+    CHECK(list.countIf([](int value) { return value > 4; }) == 14);
+    CHECK(list.accumulate(0L) == 147);
+    CHECK(list.accumulate(std::string(), [](std::string text, int value) { return text + char('0' + value); })
+              .substr(0, 9) == "012345601");
+
+    UnrolledListItr<int, 4> found = list.findIf([](int value) { return value == 6; });
+    CHECK(*found == 6);
+    found++;
+    CHECK(*found == 0);
+    CHECK(list.findIf([](int value) { return value < 0; }).isPastEnd());
+
+    list.forEach([](int &value) { value *= 2; });
+    CHECK(list.accumulate(0) == 294);
+    CHECK(list.find(12).retrieve() == 12);
+
+    UnrolledList<int, 4> empty;
+    CHECK(empty.accumulate(5) == 5);
+    CHECK(empty.findIf([](int) { return true; }).isPastEnd());
+}
@@ -0,0 +1,113 @@
+#include "../external/doctest/doctest.h"
+#include "../src/XorList.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+TEST_CASE("XorList basic operations")
+{
+    XorList<int> list;
+    CHECK(list.isEmpty());
+    CHECK(list.first().isPastEnd());
+    CHECK(list.last().isPastBeginning());
+
+    list.insertAtTail(20);
+    list.insertAtTail(30);
+    list.insertAtFront(10);
+    CHECK(list.size() == 3);
+    CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{10, 20, 30});
+    CHECK(std::vector<int>(list.rbegin(), list.rend()) == std::vector<int>{30, 20, 10});
+
+    std::ostringstream forward;
+    list.print(forward, true);
+    CHECK(forward.str() == "10 20 30 \n");
+    std::ostringstream backward;
+    list.print(backward, false);
+    CHECK(backward.str() == "30 20 10 \n");
+
+    list.remove(20);
+    list.remove(99);
+    CHECK(list.size() == 2);
+    CHECK(list.find(20).isPastEnd());
+    CHECK(list.last().retrieve() == 30);
+
+    list.makeEmpty();
+    CHECK(list.isEmpty());
+    list.insertAtFront(5);
+    CHECK(list.first().retrieve() == 5);
+    CHECK(list.last().retrieve() == 5);
+}
+
+TEST_CASE("XorList cursor-based insert and erase")
+{
+    XorList<std::string> list;
+    list.insertAtTail("a");
+    list.insertAtTail("d");
+
+    XorListItr<std::string> itr = list.find("d");
+    list.insertBefore("b", itr);
+    list.insertBefore("c", itr);
+    CHECK(itr.retrieve() == "d");
+    itr.moveBackward();
+    CHECK(itr.retrieve() == "c");
+    list.insertAfter("c2", itr);
+    itr.moveForward();
+    CHECK(itr.retrieve() == "c2");
+
+    std::ostringstream oss;
+    list.print(oss, true);
+    CHECK(oss.str() == "a b c c2 d \n");
+
+    itr = list.erase(itr);
+    CHECK(itr.retrieve() == "d");
+    itr = list.erase(itr);
+    CHECK(itr.isPastEnd());
+    CHECK_THROWS_AS(list.erase(itr), std::invalid_argument);
+    CHECK_THROWS_AS(list.insertAfter("x", itr), std::invalid_argument);
+    itr.moveBackward();
+    CHECK(itr.retrieve() == "c");
+
+    XorListItr<std::string> front = list.first();
+    front.moveBackward();
+    CHECK(front.isPastBeginning());
+    CHECK_THROWS_AS(front.retrieve(), std::runtime_error);
+    CHECK_THROWS_AS(list.insertBefore("x", front), std::invalid_argument);
+    list.insertAfter("start", front);
+    CHECK(list.first().retrieve() == "start");
+    CHECK(list.size() == 4);
+}
+
+TEST_CASE("XorList copy and move")
+{
+    XorList<int> list;
+    for (int i = 1; i <= 5; i++)
+    {
+        list.insertAtTail(i);
+    }
+
+    XorList<int> copy(list);
+    copy.remove(3);
+    CHECK(list.size() == 5);
+    CHECK(std::vector<int>(copy.begin(), copy.end()) == std::vector<int>{1, 2, 4, 5});
+
+    XorList<int> moved(std::move(copy));
+    CHECK(copy.isEmpty());
+    CHECK(std::vector<int>(moved.rbegin(), moved.rend()) == std::vector<int>{5, 4, 2, 1});
+    copy.insertAtTail(7);
+    CHECK(copy.first().retrieve() == 7);
+
+    list = moved;
+    CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{1, 2, 4, 5});
+    list = std::move(copy);
+    CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{7});
+    list.insertAtTail(8);
+    CHECK(list.last().retrieve() == 8);
+    CHECK(moved.size() == 4);
+}
+
+TEST_CASE("XorList nodes hold one link")
+{
+    CHECK(XorList<int>::bytesPerNode() == sizeof(void *) + sizeof(void *));
+    CHECK(XorList<long long>::bytesPerNode() == sizeof(void *) + sizeof(long long));
+}
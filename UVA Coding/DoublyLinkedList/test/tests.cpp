@@ -3,6 +3,20 @@
 #include "../external/doctest/doctest.h"
 #include "../src/List.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <memory_resource>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
 struct TestFixture
 {
     List<int> list;
@@ -270,4 +284,1307 @@ TEST_CASE("Test assignment operator")
     list2.print(oss, true);
     std::cout.rdbuf(coutBuf); // Restore cout's original buffer
     CHECK(oss.str() == "10 20 30 \n");
-}
\ No newline at end of file
+}
+TEST_CASE("List with a node pool")
+{
+    ListNodePool<int> pool(4);
+    List<int> list(pool);
+    CHECK(list.nodePool() == &pool);
+
+    for (int i = 0; i < 10; i++)
+    {
+        list.insertAtTail(i);
+    }
+    CHECK(list.size() == 10);
+    CHECK(pool.liveNodes() == 10);
+    CHECK(pool.blockCount() == 3);
+
+    SUBCASE("Freed nodes are reused")
+    {
+        list.remove(3);
+        list.remove(7);
+        CHECK(pool.liveNodes() == 8);
+        list.insertAtFront(30);
+        list.insertAtFront(70);
+        CHECK(pool.liveNodes() == 10);
+        CHECK(pool.blockCount() == 3);
+    }
+
+    SUBCASE("Copies share the pool")
+    {
+        List<int> copy(list);
+        CHECK(copy.nodePool() == &pool);
+        CHECK(pool.liveNodes() == 20);
+
+        std::ostringstream oss;
+        copy.print(oss, true);
+        CHECK(oss.str() == "0 1 2 3 4 5 6 7 8 9 \n");
+    }
+
+    SUBCASE("Assignment keeps the target's pool")
+    {
+        List<int> plain;
+        plain = list;
+        CHECK(plain.nodePool() == nullptr);
+        CHECK(plain.size() == 10);
+        CHECK(pool.liveNodes() == 10);
+    }
+
+    list.makeEmpty();
+    CHECK(pool.liveNodes() == 0);
+}
+
+struct CopyCounter
+{
+    static int copies;
+    int id;
+
+    CopyCounter(int id = 0) : id(id) {}
+    CopyCounter(int id, int offset) : id(id + offset) {}
+    CopyCounter(const CopyCounter &other) : id(other.id) { copies++; }
+    CopyCounter(CopyCounter &&other) noexcept : id(other.id) {}
+    CopyCounter &operator=(const CopyCounter &other)
+    {
+        id = other.id;
+        copies++;
+        return *this;
+    }
+    CopyCounter &operator=(CopyCounter &&other) noexcept
+    {
+        id = other.id;
+        return *this;
+    }
+    bool operator!=(const CopyCounter &other) const { return id != other.id; }
+};
+
+int CopyCounter::copies = 0;
+
+TEST_CASE("Move semantics and emplace")
+{
+    CopyCounter::copies = 0;
+    List<CopyCounter> list;
+
+    SUBCASE("Inserting temporaries and emplacing never copies")
+    {
+        list.insertAtTail(CopyCounter(1));
+        list.insertAtFront(CopyCounter(0));
+        list.insertAfter(CopyCounter(2), list.last());
+        list.insertBefore(CopyCounter(-1), list.first());
+        ListItr<CopyCounter> itr = list.emplaceBack(3);
+        CHECK(itr.retrieve().id == 3);
+        itr = list.emplaceFront(-3, 1);
+        CHECK(itr.retrieve().id == -2);
+        itr = list.emplaceAfter(list.first(), 5);
+        CHECK(list.emplaceBefore(itr, 4).retrieve().id == 4);
+        CHECK(list.size() == 8);
+
+        CHECK(list.find(CopyCounter(3)).retrieve().id == 3);
+        list.remove(CopyCounter(5));
+        CHECK(list.size() == 7);
+        CHECK(CopyCounter::copies == 0);
+    }
+
+    SUBCASE("Inserting an lvalue copies once")
+    {
+        CopyCounter value(7);
+        list.insertAtTail(value);
+        CHECK(CopyCounter::copies == 1);
+    }
+
+    SUBCASE("Retrieve returns a reference into the node")
+    {
+        list.emplaceBack(1);
+        list.first().retrieve().id = 10;
+        CHECK(list.first().retrieve().id == 10);
+        CHECK(CopyCounter::copies == 0);
+    }
+
+    SUBCASE("Emplacing past the end throws")
+    {
+        CHECK_THROWS_AS(list.emplaceAfter(list.first(), 1), std::invalid_argument);
+        CHECK(list.isEmpty());
+    }
+}
+
+TEST_CASE("Move constructor and move assignment")
+{
+    List<std::string> source;
+    source.insertAtTail("a");
+    source.insertAtTail("b");
+    source.insertAtTail("c");
+    const std::string *address = &source.first().retrieve();
+
+    List<std::string> moved(std::move(source));
+    CHECK(moved.size() == 3);
+    CHECK(&moved.first().retrieve() == address);
+    CHECK(source.isEmpty());
+    CHECK(source.size() == 0);
+
+    source.insertAtTail("reused");
+    CHECK(source.size() == 1);
+
+    List<std::string> target;
+    target.insertAtTail("old");
+    target = std::move(moved);
+    CHECK(target.size() == 3);
+    CHECK(&target.first().retrieve() == address);
+    CHECK(moved.isEmpty());
+
+    std::ostringstream oss;
+    target.print(oss, false);
+    CHECK(oss.str() == "c b a \n");
+
+    // A moved-from list can be assigned to and destroyed
+    List<std::string> assigned(std::move(target));
+    target = assigned;
+    CHECK(target.size() == 3);
+    List<std::string> destroyed(std::move(assigned));
+    CHECK(assigned.isEmpty());
+}
+
+TEST_CASE("Move constructor does not throw")
+{
+    static_assert(std::is_nothrow_move_constructible<List<int>>::value, "List<int> should be nothrow movable");
+    static_assert(std::is_nothrow_move_constructible<List<std::string>>::value,
+                  "List<std::string> should be nothrow movable");
+
+    // std::vector moves its lists when it grows, so the nodes (and their addresses) are kept
+    std::vector<List<int>> lists;
+    lists.emplace_back();
+    lists.back().insertAtTail(7);
+    const int *address = &lists.front().first().retrieve();
+    for (int i = 0; i < 100; i++)
+    {
+        lists.emplace_back();
+        lists.back().insertAtTail(i);
+    }
+    CHECK(&lists.front().first().retrieve() == address);
+    CHECK(lists.front().size() == 1);
+    CHECK(lists.back().last().retrieve() == 99);
+}
+
+TEST_CASE("Moved-from list is a working empty list")
+{
+    // The dummy nodes go with the move, so each use below starts from a list without them
+    auto movedFrom = []() {
+        List<int> source{1, 2, 3};
+        List<int> taken(std::move(source));
+        return source;
+    };
+
+    SUBCASE("Inserting")
+    {
+        List<int> list = movedFrom();
+        List<int> front = movedFrom();
+        List<int> emplaced = movedFrom();
+        list.insertAtTail(2);
+        front.insertAtFront(1);
+        emplaced.emplaceBack(3);
+        list.insertAtFront(1);
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{1, 2});
+        CHECK(front.first().retrieve() == 1);
+        CHECK(emplaced.last().retrieve() == 3);
+    }
+
+    SUBCASE("Iterating and searching")
+    {
+        // Read-only use first: it must not need the dummy nodes the calls after it allocate
+        List<int> list = movedFrom();
+        const List<int> &constList = list;
+        CHECK(constList.begin() == constList.end());
+        CHECK(constList.rbegin() == constList.rend());
+        CHECK(constList.occurrences(1) == 0);
+        CHECK(constList.accumulate(0) == 0);
+        CHECK(List<int>(constList).isEmpty());
+
+        std::ostringstream snapshot;
+        constList.save(snapshot);
+        List<int> loaded;
+        std::istringstream in(snapshot.str());
+        loaded.load(in);
+        CHECK(loaded.isEmpty());
+
+        CHECK(list.begin() == list.end());
+        CHECK(list.first().isPastEnd());
+        CHECK(list.last().isPastBeginning());
+        CHECK(list.find(1).isPastEnd());
+        CHECK(list.removeAll(1) == 0);
+        CHECK(list.unique() == 0);
+
+        std::ostringstream oss;
+        movedFrom().print(oss);
+        CHECK(oss.str() == "\n");
+    }
+
+    SUBCASE("Merging and splicing")
+    {
+        List<int> target{1, 3};
+        List<int> source = movedFrom();
+        target.merge(source);
+        target.splice(target.first(), source);
+        CHECK(std::vector<int>(target.begin(), target.end()) == std::vector<int>{1, 3});
+        CHECK(source.isEmpty());
+
+        List<int> into = movedFrom();
+        List<int> from{2, 4};
+        into.merge(from);
+        CHECK(std::vector<int>(into.begin(), into.end()) == std::vector<int>{2, 4});
+        CHECK(from.isEmpty());
+    }
+}
+
+TEST_CASE("Standard iterators")
+{
+    List<int> list;
+    CHECK(list.begin() == list.end());
+    CHECK(list.rbegin() == list.rend());
+
+    for (int i = 1; i <= 5; i++)
+    {
+        list.insertAtTail(i * 10);
+    }
+
+    SUBCASE("Range-for visits every element in order")
+    {
+        std::vector<int> seen;
+        for (int value : list)
+        {
+            seen.push_back(value);
+        }
+        CHECK(seen == std::vector<int>{10, 20, 30, 40, 50});
+    }
+
+    SUBCASE("Works with <algorithm> and <numeric>")
+    {
+        CHECK(std::accumulate(list.begin(), list.end(), 0) == 150);
+        CHECK(*std::find_if(list.cbegin(), list.cend(), [](int v) { return v > 25; }) == 30);
+        CHECK(std::find(list.begin(), list.end(), 99) == list.end());
+        CHECK(std::distance(list.begin(), list.end()) == 5);
+
+        std::for_each(list.begin(), list.end(), [](int &v) { v += 1; });
+        CHECK(list.first().retrieve() == 11);
+        CHECK(std::equal(list.rbegin(), list.rend(), std::vector<int>{51, 41, 31, 21, 11}.begin()));
+    }
+
+    SUBCASE("Iterators move both ways and convert to const")
+    {
+        List<int>::iterator itr = list.end();
+        --itr;
+        CHECK(*itr == 50);
+        itr--;
+        CHECK(*itr-- == 40);
+        CHECK(*itr == 30);
+        CHECK(*++itr == 40);
+        --itr;
+
+        List<int>::const_iterator citr = itr;
+        CHECK(citr == itr);
+        CHECK(*citr == 30);
+    }
+
+    SUBCASE("A const list can be iterated")
+    {
+        const List<int> &view = list;
+        std::vector<int> backwards(view.crbegin(), view.crend());
+        CHECK(backwards == std::vector<int>{50, 40, 30, 20, 10});
+        CHECK(std::accumulate(view.begin(), view.end(), 0) == 150);
+    }
+
+    SUBCASE("ListItr keeps working alongside")
+    {
+        ListItr<int> itr = list.first();
+        itr.moveForward();
+        CHECK(itr.retrieve() == *std::next(list.begin()));
+    }
+}
+
+TEST_CASE("Erase at an iterator position")
+{
+    List<int> list;
+    list.insertAtTail(10);
+    list.insertAtTail(20);
+    list.insertAtTail(30);
+
+    ListItr<int> itr = list.erase(list.find(20));
+    CHECK(itr.retrieve() == 30);
+    CHECK(list.size() == 2);
+
+    itr = list.erase(itr);
+    CHECK(itr.isPastEnd());
+    CHECK(list.last() == list.first());
+    CHECK_THROWS_AS(list.erase(itr), std::invalid_argument);
+}
+
+TEST_CASE("Move an element to the front")
+{
+    List<int> list;
+    list.insertAtTail(10);
+    list.insertAtTail(20);
+    list.insertAtTail(30);
+
+    ListItr<int> itr = list.last();
+    list.moveToFront(itr);
+    CHECK(itr.retrieve() == 30);
+    list.moveToFront(list.first());
+    list.moveToFront(list.find(20));
+
+    std::ostringstream oss;
+    list.print(oss, true);
+    CHECK(oss.str() == "20 30 10 \n");
+    std::ostringstream backward;
+    list.print(backward, false);
+    CHECK(backward.str() == "10 30 20 \n");
+    CHECK(list.size() == 3);
+}
+
+TEST_CASE("Splice, split and merge")
+{
+    List<int> list;
+    List<int> other;
+    for (int i = 1; i <= 3; i++)
+    {
+        list.insertAtTail(i * 10);
+        other.insertAtTail(i);
+    }
+
+    SUBCASE("Splicing a whole list relinks its nodes")
+    {
+        ListItr<int> moved = other.first();
+        list.splice(list.find(20), other);
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{10, 1, 2, 3, 20, 30});
+        CHECK(list.size() == 6);
+        CHECK(other.isEmpty());
+        CHECK(other.size() == 0);
+        CHECK(moved == list.find(1));
+
+        std::ostringstream backward;
+        list.print(backward, false);
+        CHECK(backward.str() == "30 20 3 2 1 10 \n");
+    }
+
+    SUBCASE("Splicing one element, also within the same list")
+    {
+        ListItr<int> pastEnd = list.last();
+        pastEnd.moveForward();
+        list.splice(pastEnd, other, other.find(2));
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{10, 20, 30, 2});
+        CHECK(std::vector<int>(other.begin(), other.end()) == std::vector<int>{1, 3});
+        CHECK(list.size() == 4);
+        CHECK(other.size() == 2);
+
+        list.splice(list.first(), list, list.last());
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{2, 10, 20, 30});
+        CHECK(list.size() == 4);
+        CHECK_THROWS_AS(list.splice(list.first(), other, pastEnd), std::invalid_argument);
+    }
+
+    SUBCASE("Splicing a range")
+    {
+        ListItr<int> pastEnd = other.last();
+        pastEnd.moveForward();
+        list.splice(list.last(), other, other.find(2), pastEnd);
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{10, 20, 2, 3, 30});
+        CHECK(list.size() == 5);
+        CHECK(other.size() == 1);
+
+        list.splice(list.first(), list, list.find(2), list.last());
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{2, 3, 10, 20, 30});
+        CHECK(list.size() == 5);
+    }
+
+    SUBCASE("Splitting counts the shorter side")
+    {
+        for (int i = 4; i <= 10; i++)
+        {
+            list.insertAtTail(i * 10);
+        }
+        List<int> back = list.splitAt(list.find(90));
+        CHECK(back.size() == 2);
+        CHECK(list.size() == 8);
+        List<int> front = list.splitAt(list.find(20));
+        CHECK(front.size() == 7);
+        CHECK(list.size() == 1);
+        CHECK(std::vector<int>(front.begin(), front.end()) == std::vector<int>{20, 30, 40, 50, 60, 70, 80});
+
+        ListItr<int> pastEnd = list.last();
+        pastEnd.moveForward();
+        CHECK(list.splitAt(pastEnd).isEmpty());
+        CHECK(list.splitAt(list.first()).size() == 1);
+        CHECK(list.isEmpty());
+    }
+
+    SUBCASE("Merging sorted lists is stable")
+    {
+        List<std::pair<int, char>> left;
+        List<std::pair<int, char>> right;
+        left.insertAtTail({1, 'l'});
+        left.insertAtTail({3, 'l'});
+        left.insertAtTail({5, 'l'});
+        right.insertAtTail({0, 'r'});
+        right.insertAtTail({3, 'r'});
+        right.insertAtTail({4, 'r'});
+        right.insertAtTail({9, 'r'});
+
+        auto byKey = [](const std::pair<int, char> &a, const std::pair<int, char> &b) { return a.first < b.first; };
+        left.merge(right, byKey);
+        std::vector<std::pair<int, char>> expected = {{0, 'r'}, {1, 'l'}, {3, 'l'}, {3, 'r'}, {4, 'r'}, {5, 'l'}, {9, 'r'}};
+        CHECK(std::vector<std::pair<int, char>>(left.begin(), left.end()) == expected);
+        CHECK(left.size() == 7);
+        CHECK(right.isEmpty());
+
+        list.merge(other);
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{1, 2, 3, 10, 20, 30});
+    }
+
+    SUBCASE("Lists with different node pools cannot exchange nodes")
+    {
+        ListNodePool<int> pool;
+        List<int> pooled(pool);
+        pooled.insertAtTail(7);
+        CHECK_THROWS_AS(list.splice(list.first(), pooled), std::invalid_argument);
+        CHECK_THROWS_AS(list.merge(pooled), std::invalid_argument);
+        CHECK(pooled.size() == 1);
+    }
+}
+
+TEST_CASE("Sort by relinking nodes")
+{
+    SUBCASE("Matches std::stable_sort at many sizes")
+    {
+        std::mt19937 rng(7);
+        for (int size : {0, 1, 2, 3, 7, 64, 100, 1000, 4097})
+        {
+            List<int> list;
+            std::vector<int> expected;
+            for (int i = 0; i < size; i++)
+            {
+                int value = static_cast<int>(rng() % 50);
+                list.insertAtTail(value);
+                expected.push_back(value);
+            }
+            list.sort();
+            std::stable_sort(expected.begin(), expected.end());
+            CHECK(std::vector<int>(list.begin(), list.end()) == expected);
+            CHECK(list.size() == size);
+            CHECK(std::vector<int>(list.rbegin(), list.rend()) == std::vector<int>(expected.rbegin(), expected.rend()));
+        }
+    }
+
+    SUBCASE("Is stable and keeps iterators on their elements")
+    {
+        List<std::pair<int, int>> list;
+        for (int i = 0; i < 20; i++)
+        {
+            list.insertAtTail({i % 3, i});
+        }
+        ListItr<std::pair<int, int>> itr = list.first();
+        list.sort([](const std::pair<int, int> &a, const std::pair<int, int> &b) { return a.first > b.first; });
+        CHECK(itr.retrieve().second == 0);
+
+        std::pair<int, int> previous = *list.begin();
+        for (const std::pair<int, int> &element : list)
+        {
+            CHECK((element.first < previous.first || (element.first == previous.first && element.second >= previous.second)));
+            previous = element;
+        }
+    }
+
+    SUBCASE("A throwing comparison keeps every element")
+    {
+        List<int> list;
+        for (int i = 100; i > 0; i--)
+        {
+            list.insertAtTail(i);
+        }
+        int comparisons = 0;
+        CHECK_THROWS_AS(list.sort([&comparisons](int a, int b) {
+            if (++comparisons == 150)
+            {
+                throw std::runtime_error("comparison failed");
+            }
+            return a < b;
+        }),
+                        std::runtime_error);
+
+        CHECK(list.size() == 100);
+        std::vector<int> values(list.begin(), list.end());
+        std::sort(values.begin(), values.end());
+        std::vector<int> expected(100);
+        std::iota(expected.begin(), expected.end(), 1);
+        CHECK(values == expected);
+        CHECK(std::distance(list.rbegin(), list.rend()) == 100);
+    }
+}
+
+struct ThrowOnCopy
+{
+    int value;
+    static int copiesLeft;
+
+    ThrowOnCopy(int v = 0) : value(v) {}
+    ThrowOnCopy(const ThrowOnCopy &other) : value(other.value)
+    {
+        if (--copiesLeft < 0)
+        {
+            throw std::runtime_error("copy failed");
+        }
+    }
+};
+
+int ThrowOnCopy::copiesLeft = 0;
+
+TEST_CASE("Building from a range")
+{
+    SUBCASE("Range and initializer-list constructors")
+    {
+        std::vector<int> values{5, 1, 4};
+        List<int> fromRange(values.begin(), values.end());
+        CHECK(fromRange.size() == 3);
+        CHECK(std::vector<int>(fromRange.begin(), fromRange.end()) == values);
+        CHECK(std::distance(fromRange.rbegin(), fromRange.rend()) == 3);
+
+        List<int> fromInit{7, 8, 9};
+        CHECK(std::vector<int>(fromInit.begin(), fromInit.end()) == std::vector<int>{7, 8, 9});
+
+        std::istringstream input("3 2 1");
+        List<int> fromStream{std::istream_iterator<int>(input), std::istream_iterator<int>()};
+        CHECK(std::vector<int>(fromStream.begin(), fromStream.end()) == std::vector<int>{3, 2, 1});
+
+        List<int> empty(values.end(), values.end());
+        CHECK(empty.isEmpty());
+    }
+
+    SUBCASE("Assign replaces the contents")
+    {
+        List<int> list{1, 2, 3, 4};
+        list.assign({10, 20});
+        CHECK(list.size() == 2);
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{10, 20});
+        list.assign(list.begin(), list.begin());
+        CHECK(list.isEmpty());
+    }
+
+    SUBCASE("Insert a range before a position")
+    {
+        List<int> list{1, 5};
+        std::vector<int> middle{2, 3, 4};
+        ListItr<int> inserted = list.insertRange(list.find(5), middle.begin(), middle.end());
+        CHECK(inserted.retrieve() == 2);
+        CHECK(list.size() == 5);
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{1, 2, 3, 4, 5});
+        CHECK(std::vector<int>(list.rbegin(), list.rend()) == std::vector<int>{5, 4, 3, 2, 1});
+
+        ListItr<int> end = list.last();
+        end.moveForward();
+        list.insertRange(end, middle.begin(), middle.begin() + 1);
+        CHECK(list.last().retrieve() == 2);
+
+        ListItr<int> unchanged = list.insertRange(list.first(), middle.end(), middle.end());
+        CHECK(unchanged.retrieve() == 1);
+        CHECK(list.size() == 6);
+
+        ListItr<int> beforeBeginning = list.first();
+        beforeBeginning.moveBackward();
+        CHECK_THROWS_AS(list.insertRange(beforeBeginning, middle.begin(), middle.end()), std::invalid_argument);
+    }
+
+    SUBCASE("Pooled nodes come from one contiguous run")
+    {
+        ListNodePool<int> pool(4);
+        List<int> list(pool);
+        list.insertAtTail(0);
+        std::vector<int> values(10);
+        std::iota(values.begin(), values.end(), 1);
+        list.insertRange(ListItr<int>(list.last()), values.begin(), values.end());
+        CHECK(pool.liveNodes() == 11);
+        CHECK(pool.blockCount() == 2);
+
+        const int *previous = nullptr;
+        for (int &value : list)
+        {
+            if (value == 0)
+            {
+                continue;
+            }
+            if (previous != nullptr)
+            {
+                CHECK(reinterpret_cast<const char *>(&value) > reinterpret_cast<const char *>(previous));
+            }
+            previous = &value;
+        }
+
+        // The three unused slots of the first block are still handed out by allocate()
+        list.insertAtTail(11);
+        list.insertAtTail(12);
+        list.insertAtTail(13);
+        CHECK(pool.blockCount() == 2);
+        CHECK(list.size() == 14);
+    }
+
+    SUBCASE("A throwing copy leaves the list unchanged")
+    {
+        ThrowOnCopy::copiesLeft = 100;
+        std::vector<ThrowOnCopy> source{1, 2, 3, 4};
+        List<ThrowOnCopy> list(source.begin(), source.begin() + 2);
+
+        ListNodePool<ThrowOnCopy> pool;
+        List<ThrowOnCopy> pooled(pool);
+        ThrowOnCopy::copiesLeft = 2;
+        CHECK_THROWS_AS(pooled.assign(source.begin(), source.end()), std::runtime_error);
+        CHECK(pooled.isEmpty());
+        CHECK(pool.liveNodes() == 0);
+
+        ThrowOnCopy::copiesLeft = 1;
+        CHECK_THROWS_AS(list.insertRange(ListItr<ThrowOnCopy>(list.first()), source.begin(), source.end()),
+                        std::runtime_error);
+        CHECK(list.size() == 2);
+        CHECK(list.first().retrieve().value == 1);
+        CHECK(std::distance(list.begin(), list.end()) == 2);
+
+        ThrowOnCopy::copiesLeft = 0;
+        CHECK_THROWS_AS(List<ThrowOnCopy>(source.begin(), source.end()), std::runtime_error);
+    }
+}
+
+TEST_CASE("Removing by predicate, value and duplicates")
+{
+    SUBCASE("removeIf removes every match in one pass")
+    {
+        List<int> list;
+        for (int i = 0; i < 20; i++)
+        {
+            list.insertAtTail(i);
+        }
+        CHECK(list.removeIf([](int value) { return value % 3 == 0; }) == 7);
+        CHECK(list.size() == 13);
+        std::vector<int> values(list.begin(), list.end());
+        CHECK(std::none_of(values.begin(), values.end(), [](int value) { return value % 3 == 0; }));
+        CHECK(std::is_sorted(values.begin(), values.end()));
+        CHECK(std::distance(list.rbegin(), list.rend()) == 13);
+        CHECK(list.removeIf([](int) { return false; }) == 0);
+        CHECK(list.removeIf([](int) { return true; }) == 13);
+        CHECK(list.isEmpty());
+    }
+
+    SUBCASE("removeAll accepts a reference to an element of the list")
+    {
+        List<int> list{4, 1, 4, 4, 2, 4};
+        CHECK(list.removeAll(list.first().retrieve()) == 4);
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{1, 2});
+        CHECK(list.removeAll(7) == 0);
+    }
+
+    SUBCASE("unique keeps the first of each run")
+    {
+        List<int> list{1, 1, 2, 2, 2, 3, 1, 1};
+        CHECK(list.unique() == 4);
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{1, 2, 3, 1});
+        CHECK(std::vector<int>(list.rbegin(), list.rend()) == std::vector<int>{1, 3, 2, 1});
+
+        List<int> close{1, 2, 3, 10, 11, 20};
+        CHECK(close.unique([](int kept, int value) { return value - kept < 5; }) == 3);
+        CHECK(std::vector<int>(close.begin(), close.end()) == std::vector<int>{1, 10, 20});
+
+        List<int> empty;
+        CHECK(empty.unique() == 0);
+    }
+
+    SUBCASE("Pooled nodes are returned as one batch and reused")
+    {
+        ListNodePool<int> pool(8);
+        List<int> list(pool);
+        for (int i = 0; i < 32; i++)
+        {
+            list.insertAtTail(i % 4);
+        }
+        CHECK(list.removeAll(0) == 8);
+        CHECK(pool.liveNodes() == 24);
+        for (int i = 0; i < 8; i++)
+        {
+            list.insertAtFront(9);
+        }
+        CHECK(pool.liveNodes() == 32);
+        CHECK(pool.blockCount() == 4);
+    }
+
+    SUBCASE("A throwing predicate keeps the list consistent")
+    {
+        List<int> list{1, 2, 3, 4, 5, 6};
+        int calls = 0;
+        CHECK_THROWS_AS(list.removeIf([&calls](int value) {
+            if (++calls == 5)
+            {
+                throw std::runtime_error("predicate failed");
+            }
+            return value % 2 == 0;
+        }),
+                        std::runtime_error);
+        CHECK(list.size() == 4);
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{1, 3, 5, 6});
+        CHECK(std::distance(list.rbegin(), list.rend()) == 4);
+    }
+}
+
+TEST_CASE("Binary save and load")
+{
+    SUBCASE("Round trip of a trivially copyable type through a stream")
+    {
+        List<int> list;
+        for (int i = 0; i < 100000; i++)
+        {
+            list.insertAtTail(i * 7 - 3);
+        }
+        std::stringstream stream;
+        list.save(stream);
+        CHECK(stream.str().size() == 24 + 100000 * sizeof(int));
+
+        List<int> loaded{1, 2, 3};
+        loaded.load(stream);
+        CHECK(loaded.size() == 100000);
+        CHECK(std::equal(loaded.begin(), loaded.end(), list.begin(), list.end()));
+        CHECK(std::distance(loaded.rbegin(), loaded.rend()) == 100000);
+    }
+
+    SUBCASE("Round trip of strings through a file into a pooled list")
+    {
+        List<std::string> list{"alpha", "", std::string(70000, 'x'), "omega"};
+        const std::string path = "/tmp/list_snapshot_test.bin";
+        list.save(path);
+
+        ListNodePool<std::string> pool(2);
+        List<std::string> loaded(pool);
+        loaded.load(path);
+        CHECK(std::vector<std::string>(loaded.begin(), loaded.end()) ==
+              std::vector<std::string>(list.begin(), list.end()));
+        CHECK(pool.liveNodes() == 4);
+        CHECK(pool.blockCount() == 1);
+        std::remove(path.c_str());
+    }
+
+    SUBCASE("An empty list round trips")
+    {
+        List<double> empty;
+        std::stringstream stream;
+        empty.save(stream);
+        List<double> loaded{1.5};
+        loaded.load(stream);
+        CHECK(loaded.isEmpty());
+    }
+
+    SUBCASE("Bad data leaves the list unchanged")
+    {
+        List<int> list{1, 2, 3};
+        std::stringstream stream;
+        list.save(stream);
+        const std::string data = stream.str();
+
+        List<int> target{9};
+        std::stringstream truncated(data.substr(0, data.size() - 2));
+        CHECK_THROWS_AS(target.load(truncated), std::runtime_error);
+
+        std::stringstream garbage("not a snapshot at all, really");
+        CHECK_THROWS_AS(target.load(garbage), std::runtime_error);
+
+        List<unsigned> otherType;
+        std::stringstream again(data);
+        CHECK_THROWS_AS(otherType.load(again), std::runtime_error);
+
+        CHECK_THROWS_AS(target.load(std::string("/nonexistent/dir/list.bin")), std::runtime_error);
+        CHECK(std::vector<int>(target.begin(), target.end()) == std::vector<int>{9});
+    }
+
+    SUBCASE("Counts in a corrupt header do not reserve memory")
+    {
+        List<int> list{1, 2, 3};
+        std::stringstream stream;
+        list.save(stream);
+        std::string data = stream.str();
+        const std::uint64_t claimed = static_cast<std::uint64_t>(std::numeric_limits<int>::max());
+        std::memcpy(&data[16], &claimed, sizeof(claimed));
+
+        ListNodePool<int> pool(64);
+        List<int> target(pool);
+        target.insertAtTail(9);
+        std::size_t blocks = pool.blockCount();
+        std::stringstream corrupt(data);
+        CHECK_THROWS_AS(target.load(corrupt), std::runtime_error);
+        CHECK(pool.blockCount() == blocks);
+        CHECK(std::vector<int>(target.begin(), target.end()) == std::vector<int>{9});
+
+        List<std::string> strings{"abc"};
+        std::stringstream stringStream;
+        strings.save(stringStream);
+        std::string stringData = stringStream.str();
+        const std::uint64_t length = std::uint64_t(1) << 40;
+        std::memcpy(&stringData[24], &length, sizeof(length));
+        List<std::string> stringTarget;
+        std::stringstream corruptLength(stringData);
+        CHECK_THROWS_AS(stringTarget.load(corruptLength), std::runtime_error);
+        CHECK(stringTarget.isEmpty());
+    }
+}
+
+template <typename T>
+static std::string printedByOperator(const std::vector<T> &values, std::ios_base &(*manipulator)(std::ios_base &))
+{
+    std::ostringstream expected;
+    manipulator(expected);
+    for (const T &value : values)
+    {
+        expected << value << " ";
+    }
+    expected << std::endl;
+    return expected.str();
+}
+
+template <typename T>
+static void checkPrintMatchesOperator(const std::vector<T> &values)
+{
+    List<T> list(values.begin(), values.end());
+    std::ostringstream actual;
+    list.print(actual, true);
+    CHECK(actual.str() == printedByOperator(values, std::dec));
+
+    std::ostringstream hex;
+    hex << std::hex;
+    list.print(hex, true);
+    CHECK(hex.str() == printedByOperator(values, std::hex));
+
+    std::ostringstream fixed;
+    fixed << std::fixed;
+    list.print(fixed, true);
+    CHECK(fixed.str() == printedByOperator(values, std::fixed));
+}
+
+TEST_CASE("Print and exportRange write the same bytes as operator<<")
+{
+    SUBCASE("Arithmetic types, including extremes")
+    {
+        std::mt19937_64 rng(7);
+        std::vector<int> ints{0, -1, 1, std::numeric_limits<int>::min(), std::numeric_limits<int>::max()};
+        std::vector<double> doubles{0.0, -0.0, 1.0, 0.1, 123456.0, 1234567.0, 1e-5, 1e-4, -2.5e300, 5e-324,
+                                    std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+                                    std::numeric_limits<double>::quiet_NaN()};
+        std::vector<float> floats{0.5f, 3.14159265f, -1e20f, 7e-12f};
+        std::vector<unsigned long long> wide{0, std::numeric_limits<unsigned long long>::max()};
+        for (int i = 0; i < 20000; i++)
+        {
+            ints.push_back(static_cast<int>(rng()));
+            std::uint64_t bits = rng();
+            double value;
+            std::memcpy(&value, &bits, sizeof(value));
+            doubles.push_back(value);
+            doubles.push_back(static_cast<double>(static_cast<std::int64_t>(rng() % 2000000)) / 1000.0);
+            wide.push_back(rng());
+        }
+        checkPrintMatchesOperator(ints);
+        checkPrintMatchesOperator(doubles);
+        checkPrintMatchesOperator(floats);
+        checkPrintMatchesOperator(wide);
+        checkPrintMatchesOperator(std::vector<long double>{1.0L / 3, -1e4000L});
+        checkPrintMatchesOperator(std::vector<short>{-32768, 5});
+    }
+
+    SUBCASE("Characters, booleans and strings keep their operator<< formatting")
+    {
+        checkPrintMatchesOperator(std::vector<char>{'a', 'b', ' '});
+        checkPrintMatchesOperator(std::vector<bool>{true, false});
+        checkPrintMatchesOperator(std::vector<std::string>{"one", "two words", ""});
+
+        List<bool> flags{true, false};
+        std::ostringstream alpha;
+        alpha << std::boolalpha;
+        flags.print(alpha, false);
+        CHECK(alpha.str() == "false true \n");
+    }
+
+    SUBCASE("Width, precision and locale changes fall back to operator<<")
+    {
+        List<double> list{1.23456789, 2.5};
+        std::ostringstream wide;
+        wide.width(8);
+        list.print(wide, true);
+        // The field width is used up by print()'s leading `os << ""`, exactly as before
+        CHECK(wide.str() == "        1.23457 2.5 \n");
+
+        std::ostringstream precise;
+        precise.precision(10);
+        list.print(precise, true);
+        CHECK(precise.str() == "1.23456789 2.5 \n");
+
+        std::ostringstream shown;
+        shown << std::showpos;
+        list.print(shown, false);
+        CHECK(shown.str() == "+2.5 +1.23457 \n");
+    }
+
+    SUBCASE("Delimiter, direction and range are configurable")
+    {
+        List<int> list{1, 2, 3, 4, 5};
+        std::ostringstream csv;
+        list.exportRange(csv, list.begin(), list.end(), ",");
+        CHECK(csv.str() == "1,2,3,4,5,");
+
+        std::ostringstream backward;
+        list.exportRange(backward, list.rbegin(), list.rend(), "\n");
+        CHECK(backward.str() == "5\n4\n3\n2\n1\n");
+
+        std::ostringstream middle;
+        list.exportRange(middle, std::next(list.begin()), std::prev(list.end()));
+        CHECK(middle.str() == "2 3 4 ");
+
+        std::ostringstream none;
+        list.exportRange(none, list.end(), list.end());
+        CHECK(none.str().empty());
+    }
+
+    SUBCASE("Writing to a file descriptor")
+    {
+        List<long long> list;
+        std::ostringstream expected;
+        for (long long i = 0; i < 100000; i++)
+        {
+            list.insertAtTail(i * 1000003 - 7);
+            expected << i * 1000003 - 7 << ";";
+        }
+
+        const std::string path = "/tmp/list_export_test." + std::to_string(::getpid()) + ".txt";
+        std::FILE *file = std::fopen(path.c_str(), "w+");
+        REQUIRE(file != nullptr);
+        list.exportRange(fileno(file), list.cbegin(), list.cend(), ";");
+        List<std::string> words{"alpha", "beta"};
+        words.exportRange(fileno(file), words.cbegin(), words.cend(), "|");
+        std::fclose(file);
+
+        std::ifstream in(path, std::ios::binary);
+        std::string written((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        CHECK(written == expected.str() + "alpha|beta|");
+        std::remove(path.c_str());
+
+        CHECK_THROWS_AS(list.exportRange(-1, list.cbegin(), list.cend()), std::system_error);
+    }
+}
+
+TEST_CASE("Traversal kernels")
+{
+    List<int> list;
+    for (int i = 0; i < 50; i++)
+    {
+        list.insertAtTail(i % 7);
+    }
+
+    CHECK(list.occurrences(3) == 7);
+    CHECK(list.occurrences(9) == 0);
+    CHECK(list.countIf([](int value) { return value > 4; }) == 14);
+    CHECK(list.accumulate(0L) == 147);
+    CHECK(list.accumulate(1.0, [](double product, int value) { return product * (value + 1); }) > 0);
+
+    ListItr<int> found = list.findIf([](int value) { return value == 6; });
+    CHECK(found.retrieve() == 6);
+    found.moveForward();
+    CHECK(found.retrieve() == 0);
+    CHECK(list.findIf([](int value) { return value < 0; }).isPastEnd());
+
+    int visited = 0;
+    list.forEach([&visited](int &value) {
+        value += 10;
+        visited++;
+    });
+    CHECK(visited == 50);
+    CHECK(list.accumulate(0) == 647);
+    CHECK(list.find(16).retrieve() == 16);
+    CHECK(list.find(6).isPastEnd());
+
+    const List<int> &constant = list;
+    CHECK(constant.countIf([](int value) { return value == 10; }) == 8);
+
+    List<std::string> words{"b", "a", "b"};
+    CHECK(words.occurrences("b") == 2);
+    CHECK(words.accumulate(std::string()) == "bab");
+}
+
+struct DestructionCounter
+{
+    static int destroyed;
+    int value;
+
+    DestructionCounter(int v = 0) : value(v) {}
+    DestructionCounter(const DestructionCounter &other) : value(other.value) {}
+    ~DestructionCounter()
+    {
+        destroyed++;
+    }
+};
+
+int DestructionCounter::destroyed = 0;
+
+TEST_CASE("Fast teardown")
+{
+    SUBCASE("A list that owns every pool node resets the pool and reuses its blocks")
+    {
+        ListNodePool<int> pool(16);
+        List<int> list(pool);
+        for (int i = 0; i < 100; i++)
+        {
+            list.insertAtTail(i);
+        }
+        list.remove(50);
+        std::size_t blocks = pool.blockCount();
+        list.makeEmpty();
+        CHECK(list.isEmpty());
+        CHECK(list.size() == 0);
+        CHECK(pool.liveNodes() == 0);
+
+        for (int i = 0; i < 100; i++)
+        {
+            list.insertAtTail(i);
+        }
+        CHECK(pool.blockCount() == blocks);
+        CHECK(list.accumulate(0) == 4950);
+        CHECK(std::distance(list.rbegin(), list.rend()) == 100);
+    }
+
+    SUBCASE("Assignment resets a pool the list owns before building the new nodes")
+    {
+        // The copy is built as one contiguous run, which fits in the first block only once the pool is reset
+        ListNodePool<int> pool(128);
+        List<int, std::allocator<int>, CountingListStats> list(pool);
+        for (int i = 0; i < 100; i++)
+        {
+            list.insertAtTail(i);
+        }
+        REQUIRE(pool.blockCount() == 1);
+
+        List<int, std::allocator<int>, CountingListStats> source;
+        for (int i = 0; i < 100; i++)
+        {
+            source.insertAtTail(-i);
+        }
+        list = source;
+        CHECK(pool.blockCount() == 1);
+        CHECK(pool.liveNodes() == 100);
+        CHECK(list.statistics().frees == 100);
+        CHECK(list.accumulate(0) == -4950);
+
+        list.assign({1, 2, 3});
+        CHECK(pool.blockCount() == 1);
+        CHECK(pool.liveNodes() == 3);
+        CHECK(std::vector<int>(list.begin(), list.end()) == std::vector<int>{1, 2, 3});
+    }
+
+    SUBCASE("A shared pool is not reset")
+    {
+        ListNodePool<int> pool(8);
+        List<int> first(pool);
+        List<int> second(pool);
+        for (int i = 0; i < 20; i++)
+        {
+            first.insertAtTail(i);
+            second.insertAtTail(-i);
+        }
+        first.makeEmpty();
+        CHECK(pool.liveNodes() == 20);
+        CHECK(second.accumulate(0) == -190);
+        second.insertAtTail(1000);
+        CHECK(second.last().retrieve() == 1000);
+        CHECK(second.accumulate(0) == 810);
+    }
+
+    SUBCASE("Values with destructors are destroyed exactly once")
+    {
+        DestructionCounter::destroyed = 0;
+        {
+            List<DestructionCounter> plain;
+            ListNodePool<DestructionCounter> pool;
+            List<DestructionCounter> pooled(pool);
+            for (int i = 0; i < 30; i++)
+            {
+                plain.insertAtTail(DestructionCounter(i));
+                pooled.insertAtTail(DestructionCounter(i));
+            }
+            DestructionCounter::destroyed = 0;
+            pooled.makeEmpty();
+            CHECK(DestructionCounter::destroyed == 30);
+            CHECK(pool.liveNodes() == 0);
+
+            plain.makeEmpty();
+            CHECK(DestructionCounter::destroyed == 60);
+        }
+    }
+
+    SUBCASE("A reset pool serves large contiguous runs from a fresh block")
+    {
+        ListNodePool<int> pool(4);
+        List<int> list(pool);
+        for (int i = 0; i < 12; i++)
+        {
+            list.insertAtTail(i);
+        }
+        list.makeEmpty();
+        std::vector<int> values(10, 7);
+        list.assign(values.begin(), values.end());
+        CHECK(list.size() == 10);
+        CHECK(pool.blockCount() == 4);
+        list.insertAtTail(8);
+        list.insertAtTail(9);
+        CHECK(pool.blockCount() == 4);
+        CHECK(list.accumulate(0) == 87);
+    }
+}
+
+// Live allocations per propagation flag and allocator id, shared by every rebound TrackingAllocator
+static int trackingLive[2][3] = {{0, 0, 0}, {0, 0, 0}};
+
+// Stateful allocator that counts live nodes per id; the template flag selects the propagation traits
+template <typename T, bool Propagate>
+struct TrackingAllocator
+{
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::integral_constant<bool, Propagate>;
+    using propagate_on_container_move_assignment = std::integral_constant<bool, Propagate>;
+    using propagate_on_container_swap = std::integral_constant<bool, Propagate>;
+
+    int id;
+
+    explicit TrackingAllocator(int theId) : id(theId) {}
+    template <typename U>
+    TrackingAllocator(const TrackingAllocator<U, Propagate> &other) : id(other.id) {}
+
+    template <typename U>
+    struct rebind
+    {
+        using other = TrackingAllocator<U, Propagate>;
+    };
+
+    T *allocate(std::size_t n)
+    {
+        trackingLive[Propagate][id] += static_cast<int>(n);
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, std::size_t n)
+    {
+        trackingLive[Propagate][id] -= static_cast<int>(n);
+        std::allocator<T>().deallocate(p, n);
+    }
+    static int live(int theId)
+    {
+        return trackingLive[Propagate][theId];
+    }
+    bool operator==(const TrackingAllocator &other) const
+    {
+        return id == other.id;
+    }
+    bool operator!=(const TrackingAllocator &other) const
+    {
+        return id != other.id;
+    }
+};
+
+TEST_CASE("Allocator-aware List")
+{
+    SUBCASE("A whole request's worth of operations runs inside a monotonic buffer")
+    {
+        alignas(std::max_align_t) static unsigned char buffer[1 << 16];
+        std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+        // Anything that falls back to the default resource (and so to the heap) throws
+        std::pmr::memory_resource *previousDefault = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+
+        {
+            ::pmr::List<int> list(&arena);
+            for (int i = 0; i < 100; i++)
+            {
+                list.insertAtTail(i % 10);
+                list.insertAtFront(-i);
+            }
+            list.insertBefore(1000, list.find(5));
+            list.remove(1000);
+            CHECK(list.removeIf([](int x) { return x < -50; }) == 49);
+            list.sort();
+            CHECK(list.unique() == 91);
+            CHECK(std::is_sorted(list.begin(), list.end()));
+
+            ::pmr::List<int> copy(list, &arena);
+            ::pmr::List<int> other({7, 8, 9}, &arena);
+            copy.splice(copy.first(), other);
+            CHECK(other.isEmpty());
+            ::pmr::List<int> rest = copy.splitAt(copy.find(0));
+            CHECK(rest.size() == 10);
+            CHECK(rest.get_allocator().resource() == &arena);
+            copy.swap(rest);
+            CHECK(copy.size() == 10);
+            list = std::move(rest);
+            CHECK(list.size() == 53);
+            CHECK(list.accumulate(0) == 7 + 8 + 9 - 1275);
+        }
+
+        CHECK_THROWS_AS(::pmr::List<int>(), std::bad_alloc);
+        std::pmr::set_default_resource(previousDefault);
+    }
+
+    SUBCASE("Allocators that propagate follow copy, move and swap")
+    {
+        using Alloc = TrackingAllocator<int, true>;
+        {
+            List<int, Alloc> a({1, 2, 3}, Alloc(1));
+            List<int, Alloc> b(Alloc(2));
+            CHECK(Alloc::live(1) == 5);
+            CHECK(Alloc::live(2) == 2);
+
+            List<int, Alloc> copy(a);
+            CHECK(copy.get_allocator().id == 1);
+
+            b = a;
+            CHECK(b.get_allocator().id == 1);
+            CHECK(Alloc::live(2) == 0);
+            CHECK(std::vector<int>(b.begin(), b.end()) == std::vector<int>{1, 2, 3});
+
+            List<int, Alloc> c(Alloc(2));
+            c = std::move(a);
+            CHECK(c.get_allocator().id == 1);
+            CHECK(a.isEmpty());
+
+            List<int, Alloc> d({4}, Alloc(2));
+            d.swap(c);
+            CHECK(d.get_allocator().id == 1);
+            CHECK(c.get_allocator().id == 2);
+            CHECK(c.first().retrieve() == 4);
+            CHECK(std::vector<int>(d.begin(), d.end()) == std::vector<int>{1, 2, 3});
+        }
+        CHECK(Alloc::live(1) == 0);
+        CHECK(Alloc::live(2) == 0);
+    }
+
+    SUBCASE("Allocators that do not propagate stay with their list")
+    {
+        using Alloc = TrackingAllocator<int, false>;
+        {
+            List<int, Alloc> a({1, 2, 3}, Alloc(1));
+            List<int, Alloc> b(Alloc(2));
+
+            b = a;
+            CHECK(b.get_allocator().id == 2);
+            CHECK(Alloc::live(2) == 5);
+
+            // Unequal allocators: the values move into nodes of the destination's allocator
+            List<int, Alloc> c(Alloc(2));
+            c = std::move(a);
+            CHECK(c.get_allocator().id == 2);
+            CHECK(a.isEmpty());
+            CHECK(Alloc::live(1) == 2);
+            CHECK(Alloc::live(2) == 10);
+            CHECK(std::vector<int>(c.begin(), c.end()) == std::vector<int>{1, 2, 3});
+
+            List<int, Alloc> moved(std::move(c), Alloc(1));
+            CHECK(c.isEmpty());
+            CHECK(moved.size() == 3);
+            CHECK(Alloc::live(1) == 7);
+
+            CHECK_THROWS_AS(moved.swap(b), std::invalid_argument);
+            CHECK_THROWS_AS(moved.splice(moved.first(), b), std::invalid_argument);
+            CHECK(b.size() == 3);
+            CHECK(moved.size() == 3);
+        }
+        CHECK(Alloc::live(1) == 0);
+        CHECK(Alloc::live(2) == 0);
+    }
+}